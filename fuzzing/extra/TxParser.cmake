@@ -12,16 +12,46 @@ set(CMAKE_C_FLAGS_DEBUG
 )
 
 add_library(txparser SHARED
+    ${CMAKE_CURRENT_SOURCE_DIR}/../host/cx.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../host/globals.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/base64.c
     ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/bip32.c
-    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/varint.c
-    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/read.c
-    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/write.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/bits.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/boc.c
     ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/buffer.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/cell.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/crc16.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/encoding.c
     ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/format.c
-    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/utils.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/format_address.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/format_bigint.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/hasher.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/hints.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/int256.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/read.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/write.c
     ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/deserialize.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/hash.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/schema.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/highload.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/out_list.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/request.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/w5.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/transaction/transaction_hints.c
 )
 
+# strlcpy is only part of glibc since 2.38
+include(CheckSymbolExists)
+check_symbol_exists(strlcpy "string.h" HAVE_STRLCPY)
+if(NOT HAVE_STRLCPY)
+    target_sources(txparser PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/../unit-tests/strlcpy_impl.c)
+    set_source_files_properties(${CMAKE_CURRENT_SOURCE_DIR}/../src/common/int256.c
+        PROPERTIES COMPILE_OPTIONS -Wno-implicit-function-declaration)
+endif()
+
 set_target_properties(txparser PROPERTIES SOVERSION 1)
 
-target_include_directories(txparser PUBLIC ${CMAKE_CURRENT_SOURCE_DIR}/../src)
+target_include_directories(txparser PUBLIC
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src
+    ${CMAKE_CURRENT_SOURCE_DIR}/../host
+)
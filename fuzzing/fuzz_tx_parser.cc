@@ -6,6 +6,7 @@
 extern "C" {
 #include "common/buffer.h"
 #include "transaction/deserialize.h"
+#include "transaction/request.h"
 #include "transaction/types.h"
 }
 
@@ -20,7 +21,8 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
 
     memset(&tx, 0, sizeof(tx));
 
-    status = transaction_deserialize(&buf, &tx);
+    transaction_deserialize_init(&tx);
+    status = request_deserialize_chunk(&buf, &tx, true);
 
     if (status == PARSING_OK) {
         printf("ok\n");
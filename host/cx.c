@@ -0,0 +1,133 @@
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint*_t
+#include <string.h>  // memcpy, memset
+
+#include "cx.h"
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static const uint32_t K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static void sha256_compress(uint32_t acc[8], const uint8_t block[64]) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t) block[4 * i] << 24) | ((uint32_t) block[4 * i + 1] << 16) |
+               ((uint32_t) block[4 * i + 2] << 8) | (uint32_t) block[4 * i + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = acc[0], b = acc[1], c = acc[2], d = acc[3];
+    uint32_t e = acc[4], f = acc[5], g = acc[6], h = acc[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + K[i] +
+                      w[i];
+        uint32_t t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    acc[0] += a;
+    acc[1] += b;
+    acc[2] += c;
+    acc[3] += d;
+    acc[4] += e;
+    acc[5] += f;
+    acc[6] += g;
+    acc[7] += h;
+}
+
+cx_err_t cx_sha256_init_no_throw(cx_sha256_t *hash) {
+    static const uint32_t iv[8] = {0x6a09e667,
+                                   0xbb67ae85,
+                                   0x3c6ef372,
+                                   0xa54ff53a,
+                                   0x510e527f,
+                                   0x9b05688c,
+                                   0x1f83d9ab,
+                                   0x5be0cd19};
+
+    memset(hash, 0, sizeof(*hash));
+    hash->header.algo = CX_SHA256;
+    memcpy(hash->acc, iv, sizeof(iv));
+
+    return CX_OK;
+}
+
+cx_err_t cx_hash_no_throw(cx_hash_t *hash,
+                          uint32_t mode,
+                          const uint8_t *in,
+                          size_t len,
+                          uint8_t *out,
+                          size_t out_len) {
+    cx_sha256_t *ctx = (cx_sha256_t *) hash;
+
+    if (hash->algo != CX_SHA256 || (len > 0 && in == NULL)) {
+        return 1;
+    }
+
+    // Absorb input, counter holds the number of compressed blocks
+    while (len > 0) {
+        size_t n = sizeof(ctx->block) - ctx->blen;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(&ctx->block[ctx->blen], in, n);
+        ctx->blen += n;
+        in += n;
+        len -= n;
+        if (ctx->blen == sizeof(ctx->block)) {
+            sha256_compress(ctx->acc, ctx->block);
+            ctx->blen = 0;
+            hash->counter++;
+        }
+    }
+
+    if ((mode & CX_LAST) == 0) {
+        return CX_OK;
+    }
+
+    if (out == NULL || out_len < CX_SHA256_SIZE) {
+        return 1;
+    }
+
+    // Padding and message length in bits
+    uint64_t bit_len = ((uint64_t) hash->counter * 64 + ctx->blen) * 8;
+    ctx->block[ctx->blen++] = 0x80;
+    if (ctx->blen > 56) {
+        memset(&ctx->block[ctx->blen], 0, sizeof(ctx->block) - ctx->blen);
+        sha256_compress(ctx->acc, ctx->block);
+        ctx->blen = 0;
+    }
+    memset(&ctx->block[ctx->blen], 0, 56 - ctx->blen);
+    for (int i = 0; i < 8; i++) {
+        ctx->block[56 + i] = (uint8_t) (bit_len >> (56 - 8 * i));
+    }
+    sha256_compress(ctx->acc, ctx->block);
+
+    for (int i = 0; i < 8; i++) {
+        out[4 * i] = (uint8_t) (ctx->acc[i] >> 24);
+        out[4 * i + 1] = (uint8_t) (ctx->acc[i] >> 16);
+        out[4 * i + 2] = (uint8_t) (ctx->acc[i] >> 8);
+        out[4 * i + 3] = (uint8_t) ctx->acc[i];
+    }
+
+    return cx_sha256_init_no_throw(ctx);
+}
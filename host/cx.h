@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * Host stand-in for the subset of the BOLOS cryptography API used by the
+ * parsing and hashing code, so that it can be built and tested on Linux.
+ * SHA-256 is provided by a portable implementation (see cx.c).
+ */
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint*_t
+
+#define CX_OK   0x00000000
+#define CX_LAST (1 << 0)
+
+#define CX_SHA256_SIZE 32
+
+typedef uint32_t cx_err_t;
+
+typedef enum {
+    CX_NONE = 0,
+    CX_SHA256 = 3,
+    CX_SHA512 = 5,
+} cx_md_t;
+
+typedef struct {
+    cx_md_t algo;
+    uint32_t counter;
+} cx_hash_t;
+
+typedef struct {
+    cx_hash_t header;
+    size_t blen;
+    uint8_t block[64];
+    uint32_t acc[8];
+} cx_sha256_t;
+
+typedef struct {
+    uint32_t curve;
+    size_t d_len;
+    uint8_t d[64];
+} cx_ecfp_private_key_t;
+
+cx_err_t cx_sha256_init_no_throw(cx_sha256_t *hash);
+
+cx_err_t cx_hash_no_throw(cx_hash_t *hash,
+                          uint32_t mode,
+                          const uint8_t *in,
+                          size_t len,
+                          uint8_t *out,
+                          size_t out_len);
@@ -0,0 +1,10 @@
+#include "globals.h"
+
+/**
+ * Host definitions of the application globals referenced by the parsing code.
+ * Settings are all disabled, as on a freshly installed application.
+ */
+
+global_ctx_t G_context;
+
+const internalStorage_t N_storage_real;
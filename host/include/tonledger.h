@@ -0,0 +1,149 @@
+#pragma once
+
+/**
+ * libtonledger: the request parsers of the TON application built for the host.
+ *
+ * Requests are parsed and hashed by the same code as on the device, so that a host can
+ * reject requests the device would refuse and predict the hash it signs and the hints it
+ * displays before sending anything to the device. Hints are the ones displayed with expert
+ * mode disabled.
+ *
+ * The API only uses C types and opaque handles, a request handle must not be used by
+ * several threads at once.
+ */
+
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Version of the API, incremented when it changes incompatibly.
+ */
+#define TONLEDGER_API_VERSION 1
+
+/**
+ * Length of the hash signed for a request (bytes).
+ */
+#define TONLEDGER_HASH_LEN 32
+
+/**
+ * Status returned by the functions of the library.
+ */
+typedef enum {
+    TONLEDGER_OK = 0,                 /// success
+    TONLEDGER_ERR_ARGUMENT = -1,      /// invalid argument or no request parsed
+    TONLEDGER_ERR_TX_PARSING = -2,    /// transaction rejected as with SW_TX_PARSING_FAIL
+    TONLEDGER_ERR_DATA_PARSING = -3,  /// custom data rejected as with SW_SIGN_DATA_PARSING_FAIL
+    TONLEDGER_ERR_DATA_LENGTH = -4,   /// custom data too long, SW_WRONG_SIGN_DATA_LENGTH
+} tonledger_status_e;
+
+/**
+ * Parsed request, either a transaction or custom data.
+ */
+typedef struct tonledger_request tonledger_request_t;
+
+/**
+ * @return TONLEDGER_API_VERSION of the library.
+ */
+int tonledger_api_version(void);
+
+/**
+ * Allocate a request.
+ *
+ * @return pointer to the request, NULL if out of memory.
+ */
+tonledger_request_t *tonledger_request_new(void);
+
+/**
+ * Free a request, NULL is ignored.
+ */
+void tonledger_request_free(tonledger_request_t *request);
+
+/**
+ * Parse and hash a transaction request, as sent after the BIP32 path of SIGN_TX.
+ *
+ * @param[out] request
+ *   Pointer to request, overwritten.
+ * @param[in]  data
+ *   Pointer to transaction request.
+ * @param[in]  data_len
+ *   Length of transaction request.
+ *
+ * @return TONLEDGER_OK if the device would accept the request, error status otherwise.
+ */
+int tonledger_parse_transaction(tonledger_request_t *request, const uint8_t *data, size_t data_len);
+
+/**
+ * Parse and hash a custom data request, as sent after the BIP32 path of SIGN_DATA.
+ *
+ * @param[out] request
+ *   Pointer to request, overwritten.
+ * @param[in]  data
+ *   Pointer to custom data request.
+ * @param[in]  data_len
+ *   Length of custom data request.
+ *
+ * @return TONLEDGER_OK if the device would accept the request, error status otherwise.
+ */
+int tonledger_parse_sign_data(tonledger_request_t *request, const uint8_t *data, size_t data_len);
+
+/**
+ * @return internal parser status of the last transaction parsed, 0 if it was parsed,
+ * negative otherwise. Only meant for diagnostics, values may change between versions.
+ */
+int tonledger_parser_status(const tonledger_request_t *request);
+
+/**
+ * Get the hash the device signs, the one returned along with the signature.
+ *
+ * @param[in]  request
+ *   Pointer to parsed request.
+ * @param[out] hash
+ *   Pointer to hash.
+ *
+ * @return TONLEDGER_OK if success, TONLEDGER_ERR_ARGUMENT if no request was parsed.
+ */
+int tonledger_hash(const tonledger_request_t *request, uint8_t hash[TONLEDGER_HASH_LEN]);
+
+/**
+ * @return whether the transaction can only be signed with blind signing enabled.
+ */
+bool tonledger_is_blind(const tonledger_request_t *request);
+
+/**
+ * @return number of hints displayed for the request, 0 if no request was parsed.
+ */
+size_t tonledger_hints_count(const tonledger_request_t *request);
+
+/**
+ * Format a hint as displayed, truncated strings end with '~'.
+ *
+ * @param[in]  request
+ *   Pointer to parsed request.
+ * @param[in]  index
+ *   Index of hint.
+ * @param[out] title
+ *   Pointer to title, zero terminated.
+ * @param[in]  title_len
+ *   Length of title buffer, 32 holds any title.
+ * @param[out] value
+ *   Pointer to value, zero terminated.
+ * @param[in]  value_len
+ *   Length of value buffer, 256 holds any value.
+ *
+ * @return TONLEDGER_OK if success, TONLEDGER_ERR_ARGUMENT if there is no such hint.
+ */
+int tonledger_hint(const tonledger_request_t *request,
+                   size_t index,
+                   char *title,
+                   size_t title_len,
+                   char *value,
+                   size_t value_len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,21 @@
+#pragma once
+
+/**
+ * Host stand-in for the BOLOS system header. Only the definitions needed by
+ * the parsing and hashing code are provided.
+ */
+
+#include <string.h>  // explicit_bzero
+
+#ifndef IO_SEPROXYHAL_BUFFER_SIZE_B
+#define IO_SEPROXYHAL_BUFFER_SIZE_B 300
+#endif
+
+#ifndef PRINTF
+#define PRINTF(...)
+#endif
+
+/**
+ * Position independent code is not a concern on host, pointers are used as is.
+ */
+#define PIC(x) ((void *) (x))
@@ -0,0 +1,7 @@
+#pragma once
+
+/**
+ * Host stand-in for the BOLOS SE proxy HAL header.
+ */
+
+#include "os.h"
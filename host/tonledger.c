@@ -0,0 +1,152 @@
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+#include <stdlib.h>   // calloc, free
+#include <string.h>   // memcpy, memset
+
+#include "include/tonledger.h"
+
+#include "types.h"
+#include "common/buffer.h"
+#include "common/hints.h"
+#include "sign_data/sign_data_deserialize.h"
+#include "transaction/request.h"
+#include "transaction/deserialize.h"
+
+typedef enum {
+    REQUEST_NONE,
+    REQUEST_TRANSACTION,
+    REQUEST_SIGN_DATA,
+} request_kind_e;
+
+struct tonledger_request {
+    request_kind_e kind;  /// kind of the request parsed, REQUEST_NONE if it was rejected
+    int parser_status;    /// parser_status_e of the last transaction parsed
+    union {
+        transaction_ctx_t tx_info;
+        sign_data_ctx_t sign_data_info;
+    };
+};
+
+static const HintHolder_t *request_hints(const tonledger_request_t *request) {
+    if (request == NULL) {
+        return NULL;
+    }
+
+    switch (request->kind) {
+        case REQUEST_TRANSACTION:
+            return &request->tx_info.transaction.hints;
+        case REQUEST_SIGN_DATA:
+            return &request->sign_data_info.hints;
+        default:
+            return NULL;
+    }
+}
+
+int tonledger_api_version(void) {
+    return TONLEDGER_API_VERSION;
+}
+
+tonledger_request_t *tonledger_request_new(void) {
+    return calloc(1, sizeof(tonledger_request_t));
+}
+
+void tonledger_request_free(tonledger_request_t *request) {
+    free(request);
+}
+
+int tonledger_parse_transaction(tonledger_request_t *request,
+                                const uint8_t *data,
+                                size_t data_len) {
+    if (request == NULL || (data == NULL && data_len > 0)) {
+        return TONLEDGER_ERR_ARGUMENT;
+    }
+
+    // Same steps as SIGN_TX with the request in a single chunk
+    memset(request, 0, sizeof(*request));
+    transaction_t *tx = &request->tx_info.transaction;
+    buffer_t buf = {.ptr = data, .size = data_len, .offset = 0};
+    transaction_deserialize_init(tx);
+
+    request->parser_status = request_deserialize_chunk(&buf, tx, true);
+    if (request->parser_status != PARSING_OK || !request_hash(&request->tx_info)) {
+        return TONLEDGER_ERR_TX_PARSING;
+    }
+    request->kind = REQUEST_TRANSACTION;
+
+    return TONLEDGER_OK;
+}
+
+int tonledger_parse_sign_data(tonledger_request_t *request, const uint8_t *data, size_t data_len) {
+    if (request == NULL || (data == NULL && data_len > 0)) {
+        return TONLEDGER_ERR_ARGUMENT;
+    }
+
+    // Same steps as SIGN_DATA, hints point into the copy of the data
+    memset(request, 0, sizeof(*request));
+    sign_data_ctx_t *ctx = &request->sign_data_info;
+    if (data_len > sizeof(ctx->raw_data)) {
+        return TONLEDGER_ERR_DATA_LENGTH;
+    }
+    memcpy(ctx->raw_data, data, data_len);
+    ctx->raw_data_len = data_len;
+
+    buffer_t buf = {.ptr = ctx->raw_data, .size = ctx->raw_data_len, .offset = 0};
+    if (!sign_data_check_chunk(ctx->raw_data, ctx->raw_data_len, 0) ||
+        !sign_data_deserialize(&buf, ctx)) {
+        return TONLEDGER_ERR_DATA_PARSING;
+    }
+    request->kind = REQUEST_SIGN_DATA;
+
+    return TONLEDGER_OK;
+}
+
+int tonledger_parser_status(const tonledger_request_t *request) {
+    return request != NULL ? request->parser_status : PARSING_OK;
+}
+
+int tonledger_hash(const tonledger_request_t *request, uint8_t hash[TONLEDGER_HASH_LEN]) {
+    if (request == NULL || hash == NULL) {
+        return TONLEDGER_ERR_ARGUMENT;
+    }
+
+    switch (request->kind) {
+        case REQUEST_TRANSACTION:
+            memcpy(hash, request->tx_info.m_hash, TONLEDGER_HASH_LEN);
+            return TONLEDGER_OK;
+        case REQUEST_SIGN_DATA:
+            memcpy(hash, request->sign_data_info.cell_hash, TONLEDGER_HASH_LEN);
+            return TONLEDGER_OK;
+        default:
+            return TONLEDGER_ERR_ARGUMENT;
+    }
+}
+
+bool tonledger_is_blind(const tonledger_request_t *request) {
+    return request != NULL && request->kind == REQUEST_TRANSACTION &&
+           request->tx_info.transaction.is_blind;
+}
+
+size_t tonledger_hints_count(const tonledger_request_t *request) {
+    const HintHolder_t *hints = request_hints(request);
+
+    return hints != NULL ? hints->hints_count : 0;
+}
+
+int tonledger_hint(const tonledger_request_t *request,
+                   size_t index,
+                   char *title,
+                   size_t title_len,
+                   char *value,
+                   size_t value_len) {
+    const HintHolder_t *hints = request_hints(request);
+
+    if (hints == NULL || index >= hints->hints_count || title == NULL || title_len == 0 ||
+        value == NULL || value_len == 0) {
+        return TONLEDGER_ERR_ARGUMENT;
+    }
+
+    print_hint((HintHolder_t *) hints, (uint16_t) index, title, title_len, value, value_len);
+
+    return TONLEDGER_OK;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+/**
+ * Host stand-in for the BOLOS UX header.
+ */
+
+typedef struct {
+    int unused;
+} ux_state_t;
+
+typedef struct {
+    int unused;
+} bolos_ux_params_t;
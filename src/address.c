@@ -20,107 +20,149 @@
 #include <stdbool.h>  // bool
 #include <string.h>   // memmove
 
-#include "cx.h"
+#include "os.h"
 
 #include "address.h"
 
 #include "transaction/types.h"
 #include "common/crc16.h"
 #include "common/format_address.h"
+#include "common/hasher.h"
+#include "common/pubkey_cache.h"
 #include "constants.h"
 
-#define SAFE(RES)         \
-    if ((RES) != CX_OK) { \
-        return false;     \
+#define SAFE(RES)     \
+    if (!(RES)) {     \
+        return false; \
     }
 
-const uint8_t root_header[] = {
-    // Cell data and refs descriptor
-    0x02,
-    0x01,
-    0x34,
-    0x00,
-    0x07,
-    0x00,
-    0x00,
-    // Code cell hash
-    0xfe,
-    0xb5,
-    0xff,
-    0x68,
-    0x20,
-    0xe2,
-    0xff,
-    0x0d,
-    0x94,
-    0x83,
-    0xe7,
-    0xe0,
-    0xd6,
-    0x2c,
-    0x81,
-    0x7d,
-    0x84,
-    0x67,
-    0x89,
-    0xfb,
-    0x4a,
-    0xe5,
-    0x80,
-    0xc8,
-    0x78,
-    0x86,
-    0x6d,
-    0x95,
-    0x9d,
-    0xab,
-    0xd5,
-    0xc0};
-
-const uint8_t data_header[] = {
-    0x00,
-    0x51,  // Cell header
-    0x00,
-    0x00,
-    0x00,
-    0x00,  // Seqno
-    0x29,
-    0xa9,
-    0xa3,
-    0x17,  // Wallet ID
+/**
+ * Length of the constant part of the state init cell hash input: descriptors, state init
+ * bits, depths of code and data cells and code cell hash.
+ */
+#define ROOT_PREFIX_LEN (7 + HASH_LEN)
+
+/**
+ * Length of the constant part of the data cell hash input: descriptors and seqno.
+ */
+#define DATA_PREFIX_LEN 6
+
+/**
+ * Structure describing a wallet contract: the parts of the hash inputs of its address
+ * which do not depend on the public key nor on the subwallet id, and its defaults.
+ */
+typedef struct {
+    const char *name;                      // version displayed to the user
+    uint32_t default_subwallet_id;         // subwallet id used by wallet applications
+    uint8_t root_prefix[ROOT_PREFIX_LEN];  // state init cell up to the data cell hash
+    uint8_t data_prefix[DATA_PREFIX_LEN];  // data cell up to the subwallet id
+    uint8_t data_tail_len;                 // bytes of data cell after the public key
+    uint8_t data_tail[1];                  // data cell bits after the public key
+} wallet_descriptor_t;
+
+// Wallet v5 (W5R1) is not listed: the depth of its code cell is part of the address and
+// neither it, its code hash nor its data layout can be checked against the deployed contract
+// here. A wrong entry would display addresses which hold no funds.
+// clang-format off
+static const wallet_descriptor_t WALLETS[WALLET_VERSIONS_COUNT] = {
+    [WALLET_V4R2] = {
+        .name = "v4R2",
+        .default_subwallet_id = DEFAULT_SUBWALLET_ID,
+        .root_prefix = {// Cell refs and data descriptors, split_depth, special, code, data,
+                        // library bits, depth of code and data cells
+                        0x02, 0x01, 0x34, 0x00, 0x07, 0x00, 0x00,
+                        // Code cell hash
+                        0xfe, 0xb5, 0xff, 0x68, 0x20, 0xe2, 0xff, 0x0d, 0x94, 0x83, 0xe7,
+                        0xe0, 0xd6, 0x2c, 0x81, 0x7d, 0x84, 0x67, 0x89, 0xfb, 0x4a, 0xe5,
+                        0x80, 0xc8, 0x78, 0x86, 0x6d, 0x95, 0x9d, 0xab, 0xd5, 0xc0},
+        // seqno:uint32 subwallet:uint32 public_key:bits256 plugins:(HashmapE 256 int1)
+        .data_prefix = {// Cell refs and data descriptors (321 bits), seqno
+                        0x00, 0x51, 0x00, 0x00, 0x00, 0x00},
+        .data_tail_len = 1,
+        .data_tail = {0x40},  // empty plugins dictionary bit + padding
+    },
+    [WALLET_V3R2] = {
+        .name = "v3R2",
+        .default_subwallet_id = DEFAULT_SUBWALLET_ID,
+        .root_prefix = {// Cell refs and data descriptors, split_depth, special, code, data,
+                        // library bits, depth of code and data cells
+                        0x02, 0x01, 0x34, 0x00, 0x00, 0x00, 0x00,
+                        // Code cell hash
+                        0x84, 0xda, 0xfa, 0x44, 0x9f, 0x98, 0xa6, 0x98, 0x77, 0x89, 0xba,
+                        0x23, 0x23, 0x58, 0x07, 0x2b, 0xc0, 0xf7, 0x6d, 0xc4, 0x52, 0x40,
+                        0x02, 0xa5, 0xd0, 0x91, 0x8b, 0x9a, 0x75, 0xd2, 0xd5, 0x99},
+        // seqno:uint32 subwallet:uint32 public_key:bits256
+        .data_prefix = {// Cell refs and data descriptors (320 bits), seqno
+                        0x00, 0x50, 0x00, 0x00, 0x00, 0x00},
+        .data_tail_len = 0,
+    },
 };
+// clang-format on
 
-const uint8_t data_tail[] = {
-    0x40  // zero bit + padding
-};
+const char *wallet_name(wallet_version_e version) {
+    if (version >= WALLET_VERSIONS_COUNT) {
+        return NULL;
+    }
 
-bool pubkey_to_hash(const uint8_t public_key[static PUBKEY_LEN], uint8_t *out, size_t out_len) {
-    if (out_len != HASH_LEN) {
+    // Pointers kept in flash data must be relocated
+    return (const char *) PIC(WALLETS[version].name);
+}
+
+uint32_t wallet_default_subwallet_id(wallet_version_e version) {
+    if (version >= WALLET_VERSIONS_COUNT) {
+        return DEFAULT_SUBWALLET_ID;
+    }
+
+    return WALLETS[version].default_subwallet_id;
+}
+
+bool wallet_to_hash(wallet_version_e version,
+                    uint32_t subwallet_id,
+                    const uint8_t public_key[static PUBKEY_LEN],
+                    uint8_t out[static HASH_LEN]) {
+    if (version >= WALLET_VERSIONS_COUNT) {
         return false;
     }
 
+    // Only the address of the default wallet is kept in the public key cache
+    bool cached = version == WALLET_V4R2 && subwallet_id == DEFAULT_SUBWALLET_ID;
+    if (cached && pubkey_cache_find_hash(public_key, out)) {
+        return true;
+    }
+
+    const wallet_descriptor_t *wallet = &WALLETS[version];
     uint8_t inner[HASH_LEN] = {0};
-    cx_sha256_t state;
-
-    // Hash init data cell bits
-    SAFE(cx_sha256_init_no_throw(&state));
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, data_header, sizeof(data_header), NULL, 0));
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, public_key, PUBKEY_LEN, NULL, 0));
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          CX_LAST,
-                          data_tail,
-                          sizeof(data_tail),
-                          inner,
-                          sizeof(inner)));
+    hasher_t hasher;
+
+    // Hash init data cell bits, the whole input fits in one block
+    SAFE(hasher_init(&hasher));
+    SAFE(hasher_update(&hasher, wallet->data_prefix, sizeof(wallet->data_prefix)));
+    SAFE(hasher_update_be(&hasher, subwallet_id, 4));
+    SAFE(hasher_update(&hasher, public_key, PUBKEY_LEN));
+    SAFE(hasher_update(&hasher, wallet->data_tail, wallet->data_tail_len));
+    SAFE(hasher_final(&hasher, inner));
 
     // Hash root
-    SAFE(cx_sha256_init_no_throw(&state));
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, root_header, sizeof(root_header), NULL, 0));
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, CX_LAST, inner, sizeof(inner), out, out_len));
+    SAFE(hasher_init(&hasher));
+    SAFE(hasher_update(&hasher, wallet->root_prefix, sizeof(wallet->root_prefix)));
+    SAFE(hasher_update(&hasher, inner, sizeof(inner)));
+    SAFE(hasher_final(&hasher, out));
+
+    if (cached) {
+        pubkey_cache_add_hash(public_key, out);
+    }
 
     return true;
 }
 
+bool pubkey_to_hash(const uint8_t public_key[static PUBKEY_LEN], uint8_t *out, size_t out_len) {
+    if (out_len != HASH_LEN) {
+        return false;
+    }
+
+    return wallet_to_hash(WALLET_V4R2, DEFAULT_SUBWALLET_ID, public_key, out);
+}
+
 bool address_from_pubkey(const uint8_t public_key[static PUBKEY_LEN],
                          const uint8_t chain,
                          const bool bounceable,
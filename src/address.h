@@ -7,7 +7,62 @@
 #include "constants.h"
 
 /**
- * Convert public key to address hash. Uses Wallet V4 contract.
+ * Enumeration of wallet contracts whose address can be derived from a public key.
+ */
+typedef enum {
+    WALLET_V4R2 = 0,  /// wallet v4 revision 2
+    WALLET_V3R2 = 1,  /// wallet v3 revision 2
+    WALLET_VERSIONS_COUNT
+} wallet_version_e;
+
+/**
+ * Get the name of a wallet version displayed to the user.
+ *
+ * @param[in] version
+ *   Wallet contract.
+ *
+ * @return name of the version, NULL if unknown.
+ *
+ */
+const char *wallet_name(wallet_version_e version);
+
+/**
+ * Get the subwallet id used by wallet applications for a wallet version.
+ *
+ * @param[in] version
+ *   Wallet contract.
+ *
+ * @return default subwallet id of the version.
+ *
+ */
+uint32_t wallet_default_subwallet_id(wallet_version_e version);
+
+/**
+ * Convert public key to the address hash of a wallet contract with zero seqno. The
+ * constant parts of the hashed cells are kept in flash, per wallet version. The hash of
+ * the default wallet of a public key kept in the public key cache is computed once.
+ *
+ * @param[in]  version
+ *   Wallet contract.
+ * @param[in]  subwallet_id
+ *   Subwallet id stored in the wallet data.
+ * @param[in]  public_key
+ *   Pointer to byte buffer with public key.
+ *   The public key is represented as 32 bytes.
+ * @param[out] out
+ *   Pointer to output byte buffer for address hash.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool wallet_to_hash(wallet_version_e version,
+                    uint32_t subwallet_id,
+                    const uint8_t public_key[static PUBKEY_LEN],
+                    uint8_t out[static HASH_LEN]);
+
+/**
+ * Convert public key to address hash. Uses Wallet V4 contract with the default subwallet
+ * id. The hash of a public key kept in the public key cache is computed once.
  *
  * @param[in]  public_key
  *   Pointer to byte buffer with public key.
@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "dispatcher.h"
 #include "params.h"
@@ -30,15 +31,24 @@
 #include "../handler/get_version.h"
 #include "../handler/get_app_name.h"
 #include "../handler/get_public_key.h"
+#include "../handler/get_public_keys_batch.h"
 #include "../handler/sign_tx.h"
+#include "../handler/sign_tx_batch.h"
 #include "../handler/sign_data.h"
 #include "../handler/get_app_settings.h"
+#include "../handler/dry_run.h"
+#include "../handler/get_profile.h"
 
 int apdu_dispatcher(const command_t *cmd) {
     if (cmd->cla != CLA) {
         return io_send_sw(SW_CLA_NOT_SUPPORTED);
     }
 
+    // The key of a batch is kept only while its transactions are sent one after another
+    if (cmd->ins != SIGN_TX_BATCH && G_context.req_type == CONFIRM_BATCH) {
+        explicit_bzero(&G_context, sizeof(G_context));
+    }
+
     buffer_t buf = {0};
 
     switch (cmd->ins) {
@@ -55,13 +65,17 @@ int apdu_dispatcher(const command_t *cmd) {
 
             return handler_get_app_name();
         case GET_PUBLIC_KEY:
-            if (!(cmd->p1 == P1_NON_CONFIRM || cmd->p1 == P1_CONFIRM) ||
-                cmd->p2 > P2_ADDR_FLAGS_MAX) {
+            if (!(cmd->p1 == P1_NON_CONFIRM || cmd->p1 == P1_CONFIRM ||
+                  cmd->p1 == P1_ADDRESS_HASHES) ||
+                cmd->p2 > P2_PUBKEY_FLAGS_MAX) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
             if (cmd->p1 == P1_NON_CONFIRM && cmd->p2 != P2_NONE) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
+            if (cmd->p1 == P1_ADDRESS_HASHES && (cmd->p2 & ~P2_ADDR_FLAG_WALLET_SPECIFIERS)) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
 
             if (!cmd->data) {
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
@@ -71,20 +85,17 @@ int apdu_dispatcher(const command_t *cmd) {
             buf.size = cmd->lc;
             buf.offset = 0;
 
-            return handler_get_public_key(cmd->p2, &buf, (bool) cmd->p1);
+            return handler_get_public_key(cmd->p1, cmd->p2, &buf);
         case SIGN_TX:
             if (cmd->p1 != P1_NONE) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
 
+            // The path and a whole transaction may be sent in a single APDU
             if (cmd->p2 & ~(P2_FIRST | P2_MORE)) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
 
-            if ((cmd->p2 & P2_FIRST) && !(cmd->p2 & P2_MORE)) {
-                return io_send_sw(SW_WRONG_P1P2);
-            }
-
             if (!cmd->data) {
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
             }
@@ -139,6 +150,81 @@ int apdu_dispatcher(const command_t *cmd) {
             }
 
             return handler_get_app_settings();
+        case GET_PUBLIC_KEYS_BATCH:
+            if (!(cmd->p1 == P1_BATCH_PUBKEYS || cmd->p1 == P1_BATCH_ADDRESS_HASHES) ||
+                cmd->p2 != P2_NONE) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_get_public_keys_batch(cmd->p1 == P1_BATCH_ADDRESS_HASHES, &buf);
+        case SIGN_TX_BATCH:
+            if (cmd->p1 == P1_BATCH_REVIEW) {
+                if (cmd->p2 > P2_ADDR_FLAGS_MAX) {
+                    return io_send_sw(SW_WRONG_P1P2);
+                }
+            } else if (cmd->p1 == P1_BATCH_TRANSACTION) {
+                // A transaction may be sent in a single APDU
+                if (cmd->p2 & ~(P2_FIRST | P2_MORE)) {
+                    return io_send_sw(SW_WRONG_P1P2);
+                }
+            } else {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            if (cmd->p1 == P1_BATCH_REVIEW) {
+                return handler_sign_tx_batch_review(cmd->p2, &buf);
+            }
+            return handler_sign_tx_batch_transaction(&buf,
+                                                     (bool) (cmd->p2 & P2_FIRST),
+                                                     (bool) (cmd->p2 & P2_MORE));
+#ifdef HAVE_DRY_RUN
+        case DRY_RUN:
+            if (cmd->p1 == P1_DRY_RUN_HINT) {
+                return handler_dry_run_hint(cmd->p2);
+            }
+
+            if (!(cmd->p1 == P1_DRY_RUN_TRANSACTION || cmd->p1 == P1_DRY_RUN_SIGN_DATA) ||
+                (cmd->p2 & ~(P2_FIRST | P2_MORE))) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            if (!cmd->data) {
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            }
+
+            buf.ptr = cmd->data;
+            buf.size = cmd->lc;
+            buf.offset = 0;
+
+            return handler_dry_run(cmd->p1 == P1_DRY_RUN_SIGN_DATA,
+                                   &buf,
+                                   (bool) (cmd->p2 & P2_FIRST),
+                                   (bool) (cmd->p2 & P2_MORE));
+#endif
+#ifdef HAVE_PROFILE
+        case GET_PROFILE:
+            if (!(cmd->p1 == P1_PROFILE_READ || cmd->p1 == P1_PROFILE_RESET) || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+
+            return handler_get_profile(cmd->p1 == P1_PROFILE_RESET);
+#endif
         default:
             return io_send_sw(SW_INS_NOT_SUPPORTED);
     }
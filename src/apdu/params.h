@@ -15,6 +15,56 @@
  */
 #define P1_NON_CONFIRM 0x00
 
+/**
+ * P1 indicating a request for the public key and the address hashes of all wallet versions.
+ */
+#define P1_ADDRESS_HASHES 0x02
+
+/**
+ * P1 indicating a request for public keys in a batch.
+ */
+#define P1_BATCH_PUBKEYS 0x00
+
+/**
+ * P1 indicating a request for hashes of wallet v4 addresses in a batch.
+ */
+#define P1_BATCH_ADDRESS_HASHES 0x01
+
+/**
+ * P1 indicating the review of a batch of transactions.
+ */
+#define P1_BATCH_REVIEW 0x00
+
+/**
+ * P1 indicating a transaction of an approved batch.
+ */
+#define P1_BATCH_TRANSACTION 0x01
+
+/**
+ * P1 indicating a dry run of a transaction request.
+ */
+#define P1_DRY_RUN_TRANSACTION 0x00
+
+/**
+ * P1 indicating a dry run of a custom data request.
+ */
+#define P1_DRY_RUN_SIGN_DATA 0x01
+
+/**
+ * P1 indicating a request for a hint of the request of the last dry run.
+ */
+#define P1_DRY_RUN_HINT 0x02
+
+/**
+ * P1 indicating that the profile is sent.
+ */
+#define P1_PROFILE_READ 0x00
+
+/**
+ * P1 indicating that the profile is sent then reset.
+ */
+#define P1_PROFILE_RESET 0x01
+
 /**
  * P2 indicating no information.
  */
@@ -44,3 +94,13 @@
  * P2 containing all address display bits.
  */
 #define P2_ADDR_FLAGS_MAX (P2_ADDR_FLAG_TESTNET | P2_ADDR_FLAG_MASTERCHAIN)
+
+/**
+ * P2 bit indicating that a subwallet id and a wallet version follow the BIP32 path.
+ */
+#define P2_ADDR_FLAG_WALLET_SPECIFIERS 0x04
+
+/**
+ * P2 containing all GET_PUBLIC_KEY bits.
+ */
+#define P2_PUBKEY_FLAGS_MAX (P2_ADDR_FLAGS_MAX | P2_ADDR_FLAG_WALLET_SPECIFIERS)
@@ -3,7 +3,7 @@
 
 #include "base64.h"
 
-static const char base64_alphabet[] =
+const char base64_alphabet[65] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
 static const size_t base64_mod_table[] = {0, 2, 1};
 
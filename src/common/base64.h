@@ -3,6 +3,11 @@
 #include <stddef.h>  // size_t
 #include <stdint.h>  // uint*_t
 
+/**
+ * URL and filename safe base 64 alphabet.
+ */
+extern const char base64_alphabet[65];
+
 /**
  * Encode input bytes in base 64.
  *
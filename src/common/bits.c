@@ -1,5 +1,5 @@
 #include <stdint.h>  // uint*_t
-#include <string.h>  // explicit_bzero
+#include <string.h>  // explicit_bzero, memcpy
 
 #include "bits.h"
 #include "../constants.h"
@@ -22,9 +22,35 @@ void BitString_storeBit(BitString_t* self, int8_t v) {
 }
 
 void BitString_storeUint(BitString_t* self, uint64_t v, uint8_t bits) {
-    for (int i = 0; i < bits; i++) {
-        int8_t b = (v >> (bits - i - 1)) & 0x01;
-        BitString_storeBit(self, b);
+    // Fields wider than 64 bits are zero-extended on the left
+    while (bits > 64) {
+        uint8_t n = bits - 64 > 32 ? 32 : bits - 64;
+        BitString_storeUint(self, 0, n);
+        bits -= n;
+    }
+
+    // Merge the field into one big-endian 64-bit window over the bytes it touches: a
+    // byte-aligned field of up to 64 bits is a single merge, an unaligned one at most two
+    while (bits > 0) {
+        uint8_t offset = self->data_cursor % 8;
+        uint8_t n = bits < 64 - offset ? bits : 64 - offset;
+        uint8_t span = (offset + n + 7) / 8;
+        uint8_t shift = 64 - offset - n;
+        uint64_t mask = (n == 64 ? UINT64_MAX : ((uint64_t) 1 << n) - 1) << shift;
+        uint64_t chunk = (v >> (bits - n)) << shift;
+        uint8_t* dst = &self->data[self->data_cursor / 8];
+
+        uint64_t word = 0;
+        for (uint8_t i = 0; i < span; i++) {
+            word |= (uint64_t) dst[i] << (56 - 8 * i);
+        }
+        word = (word & ~mask) | (chunk & mask);
+        for (uint8_t i = 0; i < span; i++) {
+            dst[i] = (uint8_t) (word >> (56 - 8 * i));
+        }
+
+        self->data_cursor += n;
+        bits -= n;
     }
 }
 
@@ -45,9 +71,7 @@ void BitString_storeCoins(BitString_t* self, uint64_t v) {
     BitString_storeUint(self, len, 4);
 
     // Write remaining
-    for (int i = 0; i < len; i++) {
-        BitString_storeUint(self, v >> ((len - i - 1) * 8), 8);
-    }
+    BitString_storeUint(self, v, len * 8);
 }
 
 void BitString_storeCoinsBuf(BitString_t* self, uint8_t* v, uint8_t len) {
@@ -59,7 +83,22 @@ void BitString_storeCoinsBuf(BitString_t* self, uint8_t* v, uint8_t len) {
 }
 
 void BitString_storeBuffer(BitString_t* self, const uint8_t* v, uint8_t length) {
-    for (int i = 0; i < length; i++) {
+    if (self->data_cursor % 8 == 0) {
+        memcpy(&self->data[self->data_cursor / 8], v, length);
+        self->data_cursor += length * 8;
+        return;
+    }
+
+    // Unaligned: merge whole 64-bit words, then the remaining bytes
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word = 0;
+        for (int j = 0; j < 8; j++) {
+            word = (word << 8) | v[i + j];
+        }
+        BitString_storeUint(self, word, 64);
+    }
+    for (; i < length; i++) {
         BitString_storeUint(self, v[i], 8);
     }
 }
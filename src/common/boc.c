@@ -0,0 +1,420 @@
+#include <stdint.h>   // uint*_t
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+#include <string.h>   // memset, memmove
+
+#include "boc.h"
+
+#include "cell.h"
+#include "../constants.h"
+
+#define SAFE(RES)     \
+    if (!(RES)) {     \
+        return false; \
+    }
+
+#define BOC_MAGIC          0xb5ee9c72
+#define BOC_FLAG_HAS_IDX   0x80
+#define BOC_FLAG_HAS_CRC   0x40
+#define BOC_FLAG_RESERVED  0x38
+#define BOC_FLAG_REF_SIZE  0x07
+#define CELL_D1_REFS       0x07
+#define CELL_D1_EXOTIC     0x08
+#define CELL_D1_HAS_HASHES 0x10
+#define CELL_D1_LEVEL_MASK 0xe0
+
+// Pruned branch of level 1: type, level mask, hash and depth
+#define PRUNED_BRANCH_TYPE 0x01
+#define PRUNED_BRANCH_D2   (2 * (2 + HASH_LEN + 2))
+
+static uint32_t crc32c_update(uint32_t crc, uint8_t byte) {
+    crc ^= byte;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc >> 1) ^ (0x82f63b78 & (0 - (crc & 1)));
+    }
+    return crc;
+}
+
+static uint32_t read_be(const uint8_t *data, uint8_t len) {
+    uint32_t v = 0;
+    for (uint8_t i = 0; i < len; i++) {
+        v = (v << 8) | data[i];
+    }
+    return v;
+}
+
+static void expect_field(Boc_t *self, boc_state_e state, uint8_t len) {
+    self->state = state;
+    self->field_len = len;
+    self->scratch_len = 0;
+}
+
+static void next_cell(Boc_t *self) {
+    self->current++;
+    if (self->current < self->cells_count) {
+        expect_field(self, BOC_STATE_DESCRIPTOR, 2);
+    } else if (self->has_crc) {
+        expect_field(self, BOC_STATE_CRC, 4);
+    } else {
+        self->state = BOC_STATE_DONE;
+    }
+}
+
+static void cell_refs_or_next(Boc_t *self) {
+    self->current_ref = 0;
+    if (self->cells[self->current].refs_count > 0) {
+        expect_field(self, BOC_STATE_REFS, self->ref_size);
+    } else {
+        next_cell(self);
+    }
+}
+
+static bool consume_header(Boc_t *self) {
+    uint8_t flags = self->scratch[4];
+
+    SAFE(read_be(self->scratch, 4) == BOC_MAGIC);
+    SAFE((flags & BOC_FLAG_RESERVED) == 0);
+
+    self->has_crc = (flags & BOC_FLAG_HAS_CRC) != 0;
+    self->ref_size = flags & BOC_FLAG_REF_SIZE;
+    self->off_size = self->scratch[5];
+    SAFE(self->ref_size >= 1 && self->ref_size <= 2);
+    SAFE(self->off_size >= 1 && self->off_size <= 2);
+
+    self->has_idx = (flags & BOC_FLAG_HAS_IDX) != 0;
+    expect_field(self, BOC_STATE_SIZES, 3 * self->ref_size + self->off_size);
+
+    return true;
+}
+
+static bool consume_sizes(Boc_t *self) {
+    uint8_t size = self->ref_size;
+    uint32_t cells = read_be(&self->scratch[0], size);
+    uint32_t roots = read_be(&self->scratch[size], size);
+    uint32_t absent = read_be(&self->scratch[2 * size], size);
+
+    SAFE(cells >= 1 && cells <= BOC_MAX_CELLS);
+    SAFE(roots == 1);
+    SAFE(absent == 0);
+
+    self->cells_count = cells;
+    self->cells_size = read_be(&self->scratch[3 * size], self->off_size);
+    self->remaining = self->has_idx ? cells * self->off_size : 0;
+    expect_field(self, BOC_STATE_ROOT, size);
+
+    return true;
+}
+
+static bool consume_root(Boc_t *self) {
+    // Cells are stored in topological order, so the single root must come first
+    SAFE(read_be(self->scratch, self->ref_size) == 0);
+
+    self->current = 0;
+    if (self->remaining > 0) {
+        self->state = BOC_STATE_INDEX;
+    } else {
+        expect_field(self, BOC_STATE_DESCRIPTOR, 2);
+    }
+
+    return true;
+}
+
+static bool consume_descriptor(Boc_t *self) {
+    uint8_t d1 = self->scratch[0];
+    uint8_t d2 = self->scratch[1];
+    uint8_t refs_count = d1 & CELL_D1_REFS;
+    uint16_t data_len = (d2 + 1) / 2;
+    BocCell_t *cell = &self->cells[self->current];
+
+    SAFE(refs_count <= CELL_MAX_REFS);
+    SAFE((d1 & CELL_D1_HAS_HASHES) == 0);
+
+    // The only exotic cells allowed are pruned branches of level 1
+    cell->pruned = (d1 & CELL_D1_EXOTIC) != 0;
+    if (cell->pruned) {
+        SAFE(refs_count == 0);
+        SAFE((d1 & CELL_D1_LEVEL_MASK) >> 5 == 1);
+        SAFE(d2 == PRUNED_BRANCH_D2);
+    }
+
+    SAFE(self->cells_size >= 2 + data_len + (uint32_t) refs_count * self->ref_size);
+    self->cells_size -= 2 + data_len + refs_count * self->ref_size;
+
+    SAFE(data_len <= self->data_cap - self->data_len);
+    cell->data_offset = self->data_len;
+    cell->d2 = d2;
+    cell->refs_count = refs_count;
+
+    if (data_len > 0) {
+        self->state = BOC_STATE_DATA;
+        self->remaining = data_len;
+    } else {
+        cell_refs_or_next(self);
+    }
+
+    return true;
+}
+
+static bool consume_data_end(Boc_t *self) {
+    const BocCell_t *cell = &self->cells[self->current];
+    const uint8_t *data = &self->data[cell->data_offset];
+
+    // Completion tag must be present when data is not byte aligned
+    if (cell->d2 & 1) {
+        SAFE(data[cell->d2 / 2] != 0);
+    }
+    if (cell->pruned) {
+        SAFE(data[0] == PRUNED_BRANCH_TYPE);
+    }
+
+    cell_refs_or_next(self);
+
+    return true;
+}
+
+static bool consume_ref(Boc_t *self) {
+    BocCell_t *cell = &self->cells[self->current];
+    uint32_t index = read_be(self->scratch, self->ref_size);
+
+    // Topological order guarantees the absence of cycles
+    SAFE(index > self->current && index < self->cells_count);
+    cell->refs[self->current_ref++] = index;
+
+    if (self->current_ref < cell->refs_count) {
+        self->scratch_len = 0;
+    } else {
+        next_cell(self);
+    }
+
+    return true;
+}
+
+static bool consume_crc(Boc_t *self) {
+    uint32_t crc = (uint32_t) self->scratch[0] | ((uint32_t) self->scratch[1] << 8) |
+                   ((uint32_t) self->scratch[2] << 16) | ((uint32_t) self->scratch[3] << 24);
+
+    SAFE(crc == (self->crc ^ 0xffffffff));
+    self->state = BOC_STATE_DONE;
+
+    return true;
+}
+
+static bool consume_field(Boc_t *self) {
+    switch (self->state) {
+        case BOC_STATE_HEADER:
+            return consume_header(self);
+        case BOC_STATE_SIZES:
+            return consume_sizes(self);
+        case BOC_STATE_ROOT:
+            return consume_root(self);
+        case BOC_STATE_DESCRIPTOR:
+            return consume_descriptor(self);
+        case BOC_STATE_REFS:
+            return consume_ref(self);
+        case BOC_STATE_CRC:
+            return consume_crc(self);
+        default:
+            return false;
+    }
+}
+
+static bool consume(Boc_t *self, uint8_t byte) {
+    if (self->state != BOC_STATE_CRC) {
+        self->crc = crc32c_update(self->crc, byte);
+    }
+
+    switch (self->state) {
+        case BOC_STATE_INDEX:
+            if (--self->remaining == 0) {
+                expect_field(self, BOC_STATE_DESCRIPTOR, 2);
+            }
+            return true;
+        case BOC_STATE_DATA:
+            self->data[self->data_len++] = byte;
+            if (--self->remaining == 0) {
+                return consume_data_end(self);
+            }
+            return true;
+        case BOC_STATE_DONE:
+        case BOC_STATE_ERROR:
+            return false;
+        default:
+            self->scratch[self->scratch_len++] = byte;
+            if (self->scratch_len < self->field_len) {
+                return true;
+            }
+            return consume_field(self);
+    }
+}
+
+void Boc_init(Boc_t *self, uint8_t *data, uint16_t data_cap) {
+    memset(self, 0, sizeof(*self));
+    self->data = data;
+    self->data_cap = data_cap;
+    self->crc = 0xffffffff;
+    expect_field(self, BOC_STATE_HEADER, 6);
+}
+
+bool Boc_feed(Boc_t *self, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (!consume(self, data[i])) {
+            self->state = BOC_STATE_ERROR;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Boc_finalize(Boc_t *self, CellRef_t *root) {
+    SAFE(self->state == BOC_STATE_DONE);
+    SAFE(self->cells_size == 0);
+
+    // Children always follow their parents, so hash from the last cell up to the root
+    for (int i = self->cells_count - 1; i >= 0; i--) {
+        const BocCell_t *cell = &self->cells[i];
+        const uint8_t *data = &self->data[cell->data_offset];
+        CellRef_t *out = &self->hashes[i];
+
+        if (cell->pruned) {
+            // Level 0 hash and depth of the pruned subtree
+            memmove(out->hash, &data[2], HASH_LEN);
+            out->max_depth = (data[2 + HASH_LEN] << 8) | data[2 + HASH_LEN + 1];
+            continue;
+        }
+
+        CellRef_t refs[CELL_MAX_REFS];
+        for (uint8_t j = 0; j < cell->refs_count; j++) {
+            refs[j] = self->hashes[cell->refs[j]];
+        }
+        SAFE(hash_CellData(data, cell->d2, refs, cell->refs_count, out));
+    }
+
+    *root = self->hashes[0];
+
+    return true;
+}
+
+bool CellSlice_init(CellSlice_t *self, const Boc_t *boc, uint8_t cell) {
+    SAFE(boc->state == BOC_STATE_DONE && cell < boc->cells_count);
+
+    const BocCell_t *c = &boc->cells[cell];
+    SAFE(!c->pruned);
+
+    memset(self, 0, sizeof(*self));
+    self->boc = boc;
+    self->cell = cell;
+    self->bits_len = (c->d2 / 2) * 8;
+    if (c->d2 & 1) {
+        // Strip the completion tag
+        uint8_t last = boc->data[c->data_offset + c->d2 / 2];
+        uint8_t pad = 1;
+        while ((last & 1) == 0) {
+            last >>= 1;
+            pad++;
+        }
+        self->bits_len += 8 - pad;
+    }
+
+    return true;
+}
+
+bool CellSlice_loadBit(CellSlice_t *self, bool *out) {
+    uint64_t v;
+    SAFE(CellSlice_loadUint(self, 1, &v));
+    *out = v != 0;
+    return true;
+}
+
+bool CellSlice_loadUint(CellSlice_t *self, uint8_t bits, uint64_t *out) {
+    SAFE(bits <= 64 && bits <= CellSlice_remainingBits(self));
+
+    const uint8_t *data = &self->boc->data[self->boc->cells[self->cell].data_offset];
+    uint64_t v = 0;
+    while (bits > 0) {
+        uint16_t cursor = self->bits_cursor;
+        uint8_t offset = cursor % 8;
+        uint8_t take = 8 - offset;
+        if (take > bits) {
+            take = bits;
+        }
+        uint8_t chunk = (uint8_t) (data[cursor / 8] << offset) >> (8 - take);
+        v = (v << take) | chunk;
+        self->bits_cursor += take;
+        bits -= take;
+    }
+    *out = v;
+
+    return true;
+}
+
+bool CellSlice_loadBuffer(CellSlice_t *self, uint8_t *out, uint8_t len) {
+    SAFE((uint16_t) len * 8 <= CellSlice_remainingBits(self));
+
+    for (uint8_t i = 0; i < len; i++) {
+        uint64_t v;
+        SAFE(CellSlice_loadUint(self, 8, &v));
+        out[i] = (uint8_t) v;
+    }
+
+    return true;
+}
+
+bool CellSlice_loadBufferRef(CellSlice_t *self, const uint8_t **out, uint8_t len) {
+    SAFE(self->bits_cursor % 8 == 0);
+    SAFE((uint16_t) len * 8 <= CellSlice_remainingBits(self));
+
+    const uint8_t *data = &self->boc->data[self->boc->cells[self->cell].data_offset];
+    *out = &data[self->bits_cursor / 8];
+    self->bits_cursor += len * 8;
+
+    return true;
+}
+
+bool CellSlice_loadCoins(CellSlice_t *self, uint8_t *out_size, uint8_t *out, size_t out_len) {
+    uint64_t size;
+    SAFE(CellSlice_loadUint(self, 4, &size));
+    SAFE(size <= out_len);
+    SAFE(CellSlice_loadBuffer(self, out, size));
+    *out_size = size;
+
+    return true;
+}
+
+bool CellSlice_loadAddress(CellSlice_t *self, address_t *out) {
+    uint64_t v;
+
+    // addr_std$10 anycast:(Maybe Anycast) workchain_id:int8 address:bits256
+    SAFE(CellSlice_loadUint(self, 3, &v));
+    SAFE(v == 0x04);
+    SAFE(CellSlice_loadUint(self, 8, &v));
+    SAFE(v == 0x00 || v == 0xff);
+    out->chain = v;
+    SAFE(CellSlice_loadBuffer(self, out->hash, HASH_LEN));
+
+    return true;
+}
+
+bool CellSlice_loadRef(CellSlice_t *self, uint8_t *out) {
+    const BocCell_t *cell = &self->boc->cells[self->cell];
+    SAFE(self->refs_cursor < cell->refs_count);
+    *out = cell->refs[self->refs_cursor++];
+
+    return true;
+}
+
+bool CellSlice_loadRefHash(CellSlice_t *self, CellRef_t *out) {
+    uint8_t index;
+    SAFE(CellSlice_loadRef(self, &index));
+    *out = self->boc->hashes[index];
+
+    return true;
+}
+
+uint16_t CellSlice_remainingBits(const CellSlice_t *self) {
+    return self->bits_len - self->bits_cursor;
+}
+
+uint8_t CellSlice_remainingRefs(const CellSlice_t *self) {
+    return self->boc->cells[self->cell].refs_count - self->refs_cursor;
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stddef.h>   // size_t
+#include <stdbool.h>  // bool
+
+#include "types.h"
+
+/**
+ * Max number of cells in a bag of cells.
+ */
+#ifndef BOC_MAX_CELLS
+#ifdef TARGET_NANOS
+#define BOC_MAX_CELLS 4
+#else
+#define BOC_MAX_CELLS 8
+#endif
+#endif
+
+/**
+ * Max number of references of a cell.
+ */
+#define CELL_MAX_REFS 4
+
+/**
+ * Enumeration with parsing state of a bag of cells.
+ */
+typedef enum {
+    BOC_STATE_HEADER,      /// magic, flags and offset size
+    BOC_STATE_SIZES,       /// cells, roots, absent and total cells size
+    BOC_STATE_ROOT,        /// root index
+    BOC_STATE_INDEX,       /// optional offsets index, skipped
+    BOC_STATE_DESCRIPTOR,  /// cell descriptors
+    BOC_STATE_DATA,        /// cell data
+    BOC_STATE_REFS,        /// cell references
+    BOC_STATE_CRC,         /// optional CRC32-C
+    BOC_STATE_DONE,        /// all cells received
+    BOC_STATE_ERROR        /// malformed or too large bag of cells
+} boc_state_e;
+
+/**
+ * Structure for a cell of a bag of cells.
+ */
+typedef struct {
+    uint16_t data_offset;         /// offset of cell data in Boc_t.data
+    uint8_t d2;                   /// bits descriptor
+    uint8_t refs_count;           /// number of references
+    bool pruned;                  /// pruned branch, only hash and depth are known
+    uint8_t refs[CELL_MAX_REFS];  /// indexes of referenced cells
+} BocCell_t;
+
+/**
+ * Structure for incremental parsing of a serialized bag of cells with a single root.
+ *
+ * Cells are kept until the whole bag is received, then hashed bottom-up. Cell data
+ * is copied to a buffer given by the caller, which must outlive the parser.
+ * Pruned branch cells may be used in place of subtrees which the device does
+ * not need to see.
+ */
+typedef struct {
+    boc_state_e state;
+    uint8_t scratch[8];        /// accumulator of the fixed size field being read
+    uint8_t scratch_len;       /// bytes in scratch
+    uint8_t field_len;         /// length of the fixed size field being read
+    uint8_t ref_size;          /// size of cell indexes (bytes)
+    uint8_t off_size;          /// size of offsets (bytes)
+    bool has_idx;              /// offsets index is present
+    bool has_crc;              /// CRC32-C is appended
+    uint8_t cells_count;       /// number of cells
+    uint8_t current;           /// index of the cell being read
+    uint8_t current_ref;       /// index of the reference being read
+    uint16_t remaining;        /// bytes left in the current data or index
+    uint32_t cells_size;       /// bytes left in the cells section
+    uint32_t crc;              /// running CRC32-C
+    uint16_t data_len;         /// bytes used in data
+    uint16_t data_cap;         /// size of data
+    uint8_t *data;             /// cell data of all cells
+    BocCell_t cells[BOC_MAX_CELLS];
+    CellRef_t hashes[BOC_MAX_CELLS];
+} Boc_t;
+
+/**
+ * Structure for reading a cell of a parsed bag of cells.
+ */
+typedef struct {
+    const Boc_t *boc;
+    uint8_t cell;          /// index of the cell
+    uint16_t bits_cursor;  /// bits read
+    uint16_t bits_len;     /// bits in the cell
+    uint8_t refs_cursor;   /// references read
+} CellSlice_t;
+
+/**
+ * Reset a bag of cells parser.
+ *
+ * @param[out] self
+ *   Pointer to parser.
+ * @param[out] data
+ *   Buffer receiving cell data.
+ * @param[in]  data_cap
+ *   Size of data (bytes).
+ *
+ */
+void Boc_init(Boc_t *self, uint8_t *data, uint16_t data_cap);
+
+/**
+ * Feed a chunk of a serialized bag of cells to the parser.
+ *
+ * @param[in,out] self
+ *   Pointer to parser.
+ * @param[in]     data
+ *   Pointer to chunk.
+ * @param[in]     len
+ *   Length of chunk.
+ *
+ * @return true if success, false if the bag of cells is malformed or exceeds limits.
+ *
+ */
+bool Boc_feed(Boc_t *self, const uint8_t *data, size_t len);
+
+/**
+ * Hash all cells once the whole bag of cells has been fed.
+ *
+ * @param[in,out] self
+ *   Pointer to parser.
+ * @param[out]    root
+ *   Pointer to root cell reference (hash and depth).
+ *
+ * @return true if success, false if the bag of cells is incomplete or malformed.
+ *
+ */
+bool Boc_finalize(Boc_t *self, CellRef_t *root);
+
+/**
+ * Start reading a cell of a finalized bag of cells.
+ *
+ * @param[out] self
+ *   Pointer to slice.
+ * @param[in]  boc
+ *   Pointer to finalized parser.
+ * @param[in]  cell
+ *   Index of cell, root is 0.
+ *
+ * @return true if success, false if the cell does not exist or is pruned.
+ *
+ */
+bool CellSlice_init(CellSlice_t *self, const Boc_t *boc, uint8_t cell);
+
+bool CellSlice_loadBit(CellSlice_t *self, bool *out);
+bool CellSlice_loadUint(CellSlice_t *self, uint8_t bits, uint64_t *out);
+bool CellSlice_loadBuffer(CellSlice_t *self, uint8_t *out, uint8_t len);
+
+/**
+ * Get a pointer to the next bytes of a byte aligned slice, without copy.
+ *
+ * @return true if success, false if not enough bits or not byte aligned.
+ *
+ */
+bool CellSlice_loadBufferRef(CellSlice_t *self, const uint8_t **out, uint8_t len);
+
+/**
+ * Load a VarUInteger 16 as big endian bytes, in the same format as buffer_read_varuint.
+ */
+bool CellSlice_loadCoins(CellSlice_t *self, uint8_t *out_size, uint8_t *out, size_t out_len);
+
+/**
+ * Load a standard internal address (addr_std without anycast).
+ */
+bool CellSlice_loadAddress(CellSlice_t *self, address_t *out);
+
+/**
+ * Load the next reference, as index of the referenced cell.
+ */
+bool CellSlice_loadRef(CellSlice_t *self, uint8_t *out);
+
+/**
+ * Load the next reference, as its hash and depth.
+ */
+bool CellSlice_loadRefHash(CellSlice_t *self, CellRef_t *out);
+
+uint16_t CellSlice_remainingBits(const CellSlice_t *self);
+uint8_t CellSlice_remainingRefs(const CellSlice_t *self);
@@ -1,48 +1,54 @@
 #include <stdint.h>  // uint*_t
 #include <stdbool.h>
 
-#include "cx.h"
-
 #include "cell.h"
 
 #include "bits.h"
+#include "hasher.h"
+#include "profile.h"
 #include "../constants.h"
 
-#define SAFE(RES)         \
-    if ((RES) != CX_OK) { \
-        return false;     \
+#define SAFE(RES)     \
+    if (!(RES)) {     \
+        return false; \
     }
 
 bool hash_Cell(BitString_t *bits, CellRef_t *refs, uint8_t refs_count, CellRef_t *out) {
-    cx_sha256_t state;
-    SAFE(cx_sha256_init_no_throw(&state));
-
-    // Data and descriptors
     uint16_t len = bits->data_cursor;
-    uint8_t d1 = refs_count;                     // refs descriptor
     uint8_t d2 = (len >> 3) + ((len + 7) >> 3);  // bits descriptor
-    uint8_t d[2] = {d1, d2};
     BitString_finalize(bits);
 
+    return hash_CellData(bits->data, d2, refs, refs_count, out);
+}
+
+bool hash_CellData(const uint8_t *data,
+                   uint8_t d2,
+                   const CellRef_t *refs,
+                   uint8_t refs_count,
+                   CellRef_t *out) {
+    PROFILE_COUNT(PROFILE_HASH_CELL);
+
+    hasher_t hasher;
+    SAFE(hasher_init(&hasher));
+
     // Hash data and descriptors
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, d, 2, NULL, 0));
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, bits->data, bits->data_cursor / 8, NULL, 0));
+    uint8_t d1 = refs_count;  // refs descriptor
+    uint8_t d[2] = {d1, d2};
+    SAFE(hasher_update(&hasher, d, 2));
+    SAFE(hasher_update(&hasher, data, (d2 + 1) / 2));
 
     // Hash ref depths
     for (int i = 0; i < refs_count; i++) {
-        struct CellRef_t md = refs[i];
-        uint8_t mdd[2] = {md.max_depth / 256, md.max_depth % 256};
-        SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, mdd, 2, NULL, 0));
+        SAFE(hasher_update_be(&hasher, refs[i].max_depth, 2));
     }
 
-    // Hash ref depths
+    // Hash ref hashes
     for (int i = 0; i < refs_count; i++) {
-        struct CellRef_t md = refs[i];
-        SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, md.hash, HASH_LEN, NULL, 0));
+        SAFE(hasher_update(&hasher, refs[i].hash, HASH_LEN));
     }
 
     // Finalize
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state, CX_LAST, NULL, 0, out->hash, HASH_LEN));
+    SAFE(hasher_final(&hasher, out->hash));
 
     // Depth
     out->max_depth = 0;
@@ -57,4 +63,39 @@ bool hash_Cell(BitString_t *bits, CellRef_t *refs, uint8_t refs_count, CellRef_t
     }
 
     return true;
-}
\ No newline at end of file
+}
+
+bool hash_SnakeData(BitString_t *bits,
+                    const uint8_t *data,
+                    size_t data_len,
+                    CellRef_t *ref,
+                    bool *has_ref) {
+    const size_t cell_len = CELL_MAX_BITS / 8;
+    size_t head_len = (CELL_MAX_BITS - bits->data_cursor) / 8;
+
+    *has_ref = data_len > head_len;
+    if (!*has_ref) {
+        BitString_storeBuffer(bits, data, data_len);
+        return true;
+    }
+
+    // Hash the chain from its last cell back to the one following the head
+    BitString_t scratch;
+    CellRef_t next;
+    size_t offset = head_len + (data_len - head_len - 1) / cell_len * cell_len;
+    for (bool tail = true;; tail = false) {
+        size_t len = data_len - offset < cell_len ? data_len - offset : cell_len;
+        BitString_init(&scratch);
+        BitString_storeBuffer(&scratch, data + offset, len);
+        SAFE(hash_Cell(&scratch, ref, tail ? 0 : 1, &next));
+        *ref = next;
+        if (offset == head_len) {
+            break;
+        }
+        offset -= cell_len;
+    }
+
+    BitString_storeBuffer(bits, data, head_len);
+
+    return true;
+}
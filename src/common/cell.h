@@ -2,7 +2,62 @@
 
 #include <stdint.h>  // uint*_t
 #include <stdbool.h>
+#include <stddef.h>  // size_t
 
 #include "types.h"
 
+/**
+ * Max number of data bits of a cell.
+ */
+#define CELL_MAX_BITS 1023
+
 bool hash_Cell(BitString_t *bits, CellRef_t *refs, uint8_t refs_count, CellRef_t *out);
+
+/**
+ * Hash a cell given its data already padded with the completion tag, as it
+ * appears in a serialized bag of cells.
+ *
+ * @param[in]  data
+ *   Pointer to padded cell data, (d2 + 1) / 2 bytes long.
+ * @param[in]  d2
+ *   Bits descriptor of the cell.
+ * @param[in]  refs
+ *   Pointer to references of the cell.
+ * @param[in]  refs_count
+ *   Number of references.
+ * @param[out] out
+ *   Pointer to output cell reference (hash and depth).
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hash_CellData(const uint8_t *data,
+                   uint8_t d2,
+                   const CellRef_t *refs,
+                   uint8_t refs_count,
+                   CellRef_t *out);
+
+/**
+ * Store data as snake data (TEP-64): as many whole bytes as fit are appended to bits, the
+ * rest goes to a chain of cells each referencing the next one. The chain is hashed from
+ * its tail with a single scratch bit string, so stack use does not depend on data_len.
+ *
+ * @param[in,out] bits
+ *   Pointer to bits of the head cell.
+ * @param[in]     data
+ *   Pointer to data.
+ * @param[in]     data_len
+ *   Length of data.
+ * @param[out]    ref
+ *   Pointer to reference to the first cell of the chain, set if has_ref is.
+ * @param[out]    has_ref
+ *   Pointer to whether the data did not fit in bits.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hash_SnakeData(BitString_t *bits,
+                    const uint8_t *data,
+                    size_t data_len,
+                    CellRef_t *ref,
+                    bool *has_ref);
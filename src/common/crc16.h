@@ -3,6 +3,26 @@
 #include <stddef.h>  // size_t
 #include <stdint.h>  // uint*_t
 
+/**
+ * CRC of each byte value, kept in flash.
+ */
+extern const uint16_t CRC16_TABLE[256];
+
+/**
+ * Add a byte to a CRC-CCITT (XMODEM) computation.
+ *
+ * @param[in]  crc
+ *   CRC of the previous bytes, 0 for the first byte.
+ * @param[in]  byte
+ *   Byte to add.
+ *
+ * @return CRC-CCITT of the previous bytes followed by byte.
+ *
+ */
+static inline uint16_t crc16_update(uint16_t crc, uint8_t byte) {
+    return (uint16_t) (crc << 8) ^ CRC16_TABLE[(uint8_t) (crc >> 8) ^ byte];
+}
+
 /**
  * Calculate CRC-CCITT (not the normal CRC16!) for the given data.
  *
@@ -14,4 +34,20 @@
  * @return CRC-CCITT for the given data.
  *
  */
-uint16_t crc16(uint8_t *ptr, size_t count);
+uint16_t crc16(const uint8_t *ptr, size_t count);
+
+/**
+ * Add bytes to a CRC-CCITT (XMODEM) computation, so that data received in chunks can be
+ * checked as it arrives.
+ *
+ * @param[in]  crc
+ *   CRC of the previous bytes, 0 for the first chunk.
+ * @param[in]  ptr
+ *   Pointer to input byte buffer.
+ * @param[in]  count
+ *   Length of the input byte buffer.
+ *
+ * @return CRC-CCITT of the previous bytes followed by the given data.
+ *
+ */
+uint16_t crc16_continue(uint16_t crc, const uint8_t *ptr, size_t count);
@@ -7,8 +7,28 @@
 
 #include "../transaction/types.h"
 #include "crc16.h"
+#include "base64.h"
 #include "../constants.h"
 
+/**
+ * Tag byte of a friendly address.
+ */
+static uint8_t address_tag(bool bounceable, bool testOnly) {
+    uint8_t tag = bounceable ? 0x11 : 0x51;  // Bounceable or Non-Bounceable
+
+    return testOnly ? tag | 0x80 : tag;
+}
+
+/**
+ * Encode 3 bytes in 4 base 64 characters.
+ */
+static void encode_triple(uint8_t a, uint8_t b, uint8_t c, char *out) {
+    out[0] = base64_alphabet[a >> 2];
+    out[1] = base64_alphabet[((a & 0x03) << 4) | (b >> 4)];
+    out[2] = base64_alphabet[((b & 0x0f) << 2) | (c >> 6)];
+    out[3] = base64_alphabet[c & 0x3f];
+}
+
 bool address_to_friendly(const uint8_t chain,
                          const uint8_t hash[static HASH_LEN],
                          const bool bounceable,
@@ -20,14 +40,7 @@ bool address_to_friendly(const uint8_t chain,
     }
 
     // Address Tag
-    if (bounceable) {
-        out[0] = 0x11;  // Bounceable
-    } else {
-        out[0] = 0x51;  // Non-Bounceable
-    }
-    if (testOnly) {
-        out[0] = out[0] | 0x80;
-    }
+    out[0] = address_tag(bounceable, testOnly);
 
     // Workchain
     out[1] = chain;
@@ -42,3 +55,32 @@ bool address_to_friendly(const uint8_t chain,
 
     return true;
 }
+
+bool address_to_friendly_base64(const uint8_t chain,
+                                const uint8_t hash[static HASH_LEN],
+                                const bool bounceable,
+                                const bool testOnly,
+                                char *out,
+                                size_t out_len) {
+    if (out_len < FRIENDLY_ADDRESS_LEN + 1) {
+        return false;
+    }
+
+    // Tag, workchain and first byte of hash
+    uint8_t tag = address_tag(bounceable, testOnly);
+    uint16_t crc = crc16_update(crc16_update(crc16_update(0, tag), chain), hash[0]);
+    encode_triple(tag, chain, hash[0], out);
+
+    // Hash, 3 bytes per 4 characters
+    for (size_t i = 1; i < HASH_LEN - 1; i += 3) {
+        crc = crc16_update(crc16_update(crc16_update(crc, hash[i]), hash[i + 1]), hash[i + 2]);
+        encode_triple(hash[i], hash[i + 1], hash[i + 2], out + 4 * ((i + 2) / 3));
+    }
+
+    // Last byte of hash and crc16
+    crc = crc16_update(crc, hash[HASH_LEN - 1]);
+    encode_triple(hash[HASH_LEN - 1], crc >> 8, crc & 0xff, out + FRIENDLY_ADDRESS_LEN - 4);
+    out[FRIENDLY_ADDRESS_LEN] = '\0';
+
+    return true;
+}
@@ -4,6 +4,11 @@
 #include <stddef.h>   // size_t
 #include <stdbool.h>  // bool
 
+/**
+ * Length of a friendly address encoded in base 64, without terminating zero.
+ */
+#define FRIENDLY_ADDRESS_LEN 48
+
 /**
  * Convert address to friendly version that could be presented to user.
  *
@@ -29,3 +34,30 @@ bool address_to_friendly(const uint8_t chain,
                          const bool testOnly,
                          uint8_t *out,
                          size_t out_len);
+
+/**
+ * Convert address to friendly version encoded in base 64 in a single pass, without
+ * building the intermediate friendly address.
+ *
+ * @param[in]  chain
+ *   Workchain ID - 0xff or 0x00
+ * @param[in]  hash
+ *   Pointer to hash part of an address.
+ * @param[in]  bounceable
+ *   Address have to have bounceable flag set
+ * @param[in]  testOnly
+ *   Address have to have testnet flag set
+ * @param[out] out
+ *   Pointer to output string buffer, at least FRIENDLY_ADDRESS_LEN + 1 bytes.
+ * @param[in]  out_len
+ *   Length of output string buffer.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool address_to_friendly_base64(const uint8_t chain,
+                                const uint8_t hash[static 32],
+                                const bool bounceable,
+                                const bool testOnly,
+                                char *out,
+                                size_t out_len);
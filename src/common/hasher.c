@@ -0,0 +1,104 @@
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memcpy
+
+#include "cx.h"
+
+#include "hasher.h"
+#include "profile.h"
+
+#define SAFE(RES)         \
+    if ((RES) != CX_OK) { \
+        return false;     \
+    }
+
+bool hasher_init(hasher_t *hasher) {
+    hasher->block_len = 0;
+    SAFE(cx_sha256_init_no_throw(&hasher->state));
+
+    return true;
+}
+
+bool hasher_update(hasher_t *hasher, const uint8_t *data, size_t len) {
+    if (len == 0) {
+        return true;
+    }
+
+    // Complete the staged block
+    if (hasher->block_len > 0) {
+        size_t n = HASHER_BLOCK_LEN - hasher->block_len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(hasher->block + hasher->block_len, data, n);
+        hasher->block_len += n;
+        data += n;
+        len -= n;
+
+        if (hasher->block_len < HASHER_BLOCK_LEN) {
+            return true;
+        }
+        PROFILE_COUNT(PROFILE_CX_HASH);
+        SAFE(cx_hash_no_throw((cx_hash_t *) &hasher->state,
+                              0,
+                              hasher->block,
+                              HASHER_BLOCK_LEN,
+                              NULL,
+                              0));
+        hasher->block_len = 0;
+    }
+
+    // Whole blocks are not staged
+    size_t whole = len - len % HASHER_BLOCK_LEN;
+    if (whole > 0) {
+        PROFILE_COUNT(PROFILE_CX_HASH);
+        SAFE(cx_hash_no_throw((cx_hash_t *) &hasher->state, 0, data, whole, NULL, 0));
+        data += whole;
+        len -= whole;
+    }
+
+    memcpy(hasher->block, data, len);
+    hasher->block_len = len;
+
+    return true;
+}
+
+bool hasher_update_be(hasher_t *hasher, uint64_t value, uint8_t len) {
+    uint8_t bytes[8];
+
+    if (len > sizeof(bytes)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < len; i++) {
+        bytes[i] = (uint8_t) (value >> (8 * (len - 1 - i)));
+    }
+
+    return hasher_update(hasher, bytes, len);
+}
+
+bool hasher_update_le(hasher_t *hasher, uint64_t value, uint8_t len) {
+    uint8_t bytes[8];
+
+    if (len > sizeof(bytes)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < len; i++) {
+        bytes[i] = (uint8_t) (value >> (8 * i));
+    }
+
+    return hasher_update(hasher, bytes, len);
+}
+
+bool hasher_final(hasher_t *hasher, uint8_t out[static HASH_LEN]) {
+    PROFILE_COUNT(PROFILE_CX_HASH);
+    SAFE(cx_hash_no_throw((cx_hash_t *) &hasher->state,
+                          CX_LAST,
+                          hasher->block,
+                          hasher->block_len,
+                          out,
+                          HASH_LEN));
+    hasher->block_len = 0;
+
+    return true;
+}
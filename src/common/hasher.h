@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+
+#include "cx.h"
+
+#include "../constants.h"
+
+/**
+ * Length of a SHA-256 block (bytes).
+ */
+#define HASHER_BLOCK_LEN 64
+
+/**
+ * Structure for a SHA-256 computation whose input is staged in a block buffer, so that
+ * small inputs are given to the hash engine a whole block at a time.
+ */
+typedef struct {
+    cx_sha256_t state;                // hash engine state
+    uint8_t block[HASHER_BLOCK_LEN];  // input not given to the hash engine yet
+    uint8_t block_len;                // bytes in block
+} hasher_t;
+
+/**
+ * Start a SHA-256 computation.
+ *
+ * @param[out] hasher
+ *   Pointer to hasher.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hasher_init(hasher_t *hasher);
+
+/**
+ * Add bytes to the input.
+ *
+ * @param[in, out] hasher
+ *   Pointer to hasher.
+ * @param[in]      data
+ *   Pointer to input bytes.
+ * @param[in]      len
+ *   Number of input bytes.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hasher_update(hasher_t *hasher, const uint8_t *data, size_t len);
+
+/**
+ * Add an unsigned integer to the input, most significant byte first.
+ *
+ * @param[in, out] hasher
+ *   Pointer to hasher.
+ * @param[in]      value
+ *   Integer to add.
+ * @param[in]      len
+ *   Number of bytes of the integer, at most 8.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hasher_update_be(hasher_t *hasher, uint64_t value, uint8_t len);
+
+/**
+ * Add an unsigned integer to the input, least significant byte first.
+ *
+ * @param[in, out] hasher
+ *   Pointer to hasher.
+ * @param[in]      value
+ *   Integer to add.
+ * @param[in]      len
+ *   Number of bytes of the integer, at most 8.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hasher_update_le(hasher_t *hasher, uint64_t value, uint8_t len);
+
+/**
+ * Finish the computation.
+ *
+ * @param[in, out] hasher
+ *   Pointer to hasher.
+ * @param[out]     out
+ *   Pointer to hash.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hasher_final(hasher_t *hasher, uint8_t out[static HASH_LEN]);
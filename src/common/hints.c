@@ -11,88 +11,229 @@
 #include "format_bigint.h"
 #include "format_address.h"
 #include "format.h"
+#include "profile.h"
 
-void add_hint_text(HintHolder_t* hints, const char* title, const char* text, size_t text_len) {
-    // Configure
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryItemString;
-    hints->hints[hints->hints_count].string.string = text;
-    hints->hints[hints->hints_count].string.length = text_len;
+/**
+ * Offset of the record of the hint at index, data_len if index is hints_count.
+ */
+static uint16_t record_offset(const HintHolder_t* hints, uint8_t index) {
+    uint16_t offset = 0;
 
-    // Next
-    hints->hints_count++;
+    for (uint8_t i = 0; i < index; i++) {
+        offset += HINT_HEADER_LEN + hints->data[offset + 1];
+    }
+
+    return offset;
 }
 
-void add_hint_hash(HintHolder_t* hints, const char* title, uint8_t* data) {
-    // Configure
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryHash;
-    memmove(hints->hints[hints->hints_count].hash, data, HASH_LEN);
+/**
+ * Append a record header.
+ *
+ * @return pointer to the data of the record, NULL if it does not fit.
+ */
+static uint8_t* add_record(HintHolder_t* hints,
+                           const char* title,
+                           enum HintKind kind,
+                           uint8_t data_len) {
+    if (hints->hints_count >= MAX_HINTS ||
+        HINT_HEADER_LEN + data_len > (size_t) (HINTS_ARENA_LEN - hints->data_len)) {
+        return NULL;
+    }
+
+    uint8_t* record = hints->data + hints->data_len;
+    record[0] = (uint8_t) kind;
+    record[1] = data_len;
+    memcpy(record + 2, &title, sizeof(title));
 
-    // Next
+    hints->data_len += HINT_HEADER_LEN + data_len;
     hints->hints_count++;
+
+    return record + HINT_HEADER_LEN;
 }
 
-void add_hint_hex(HintHolder_t* hints, const char* title, uint8_t* data, uint8_t data_len) {
-    // Configure
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryHex;
-    memmove(hints->hints[hints->hints_count].hex.data,
-            data,
-            data_len > HASH_LEN ? HASH_LEN : data_len);
-    hints->hints[hints->hints_count].hex.len = data_len;
+static void reverse_bytes(uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len / 2; i++) {
+        uint8_t tmp = data[i];
+        data[i] = data[len - 1 - i];
+        data[len - 1 - i] = tmp;
+    }
+}
 
-    // Next
-    hints->hints_count++;
+void clear_hints(HintHolder_t* hints) {
+    hints->data_len = 0;
+    hints->hints_count = 0;
+}
+
+void truncate_hints(HintHolder_t* hints, uint8_t count) {
+    if (count < hints->hints_count) {
+        hints->data_len = record_offset(hints, count);
+        hints->hints_count = count;
+    }
+}
+
+bool hints_fit(const HintHolder_t* hints, uint8_t count) {
+    return hints->hints_count + count <= MAX_HINTS &&
+           hints->data_len + count * HINT_MAX_RECORD_LEN <= HINTS_ARENA_LEN;
+}
+
+bool add_hint_text(HintHolder_t* hints, const char* title, const char* text, size_t text_len) {
+    if (text_len > UINT16_MAX) {
+        return false;
+    }
+
+    // Text is not copied
+    uint16_t len = (uint16_t) text_len;
+    uint8_t* data = add_record(hints, title, SummaryItemString, sizeof(text) + sizeof(len));
+    if (data == NULL) {
+        return false;
+    }
+    memcpy(data, &text, sizeof(text));
+    memcpy(data + sizeof(text), &len, sizeof(len));
+
+    return true;
+}
+
+bool add_hint_hash(HintHolder_t* hints, const char* title, const uint8_t* hash) {
+    uint8_t* data = add_record(hints, title, SummaryHash, HASH_LEN);
+    if (data == NULL) {
+        return false;
+    }
+    memcpy(data, hash, HASH_LEN);
+
+    return true;
+}
+
+bool add_hint_hex(HintHolder_t* hints, const char* title, const uint8_t* hex, uint8_t hex_len) {
+    if (hex_len > HASH_LEN) {
+        return false;
+    }
+
+    uint8_t* data = add_record(hints, title, SummaryHex, hex_len);
+    if (data == NULL) {
+        return false;
+    }
+    memcpy(data, hex, hex_len);
+
+    return true;
 }
 
-void add_hint_amount(HintHolder_t* hints,
+bool add_hint_amount(HintHolder_t* hints,
                      const char* title,
                      const char* ticker,
-                     uint8_t* value,
+                     const uint8_t* value,
                      uint8_t value_len,
                      uint8_t decimals) {
-    // Configure
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryItemAmount;
-    size_t ticker_len = strnlen(ticker, MAX_TICKER_LEN);
-    memmove(hints->hints[hints->hints_count].amount.ticker, ticker, ticker_len);
-    hints->hints[hints->hints_count].amount.ticker[ticker_len] = '\0';
-    memmove(hints->hints[hints->hints_count].amount.value, value, value_len);
-    hints->hints[hints->hints_count].amount.value_len = value_len;
-    hints->hints[hints->hints_count].amount.decimals = decimals;
-
-    // Next
-    hints->hints_count++;
+    if (value_len > MAX_VALUE_BYTES_LEN) {
+        return false;
+    }
+
+    // Decimals, ticker which is not copied and value
+    uint8_t* data = add_record(hints, title, SummaryItemAmount, 1 + sizeof(ticker) + value_len);
+    if (data == NULL) {
+        return false;
+    }
+    data[0] = decimals;
+    memcpy(data + 1, &ticker, sizeof(ticker));
+    memcpy(data + 1 + sizeof(ticker), value, value_len);
+
+    return true;
 }
 
-void add_hint_address(HintHolder_t* hints, const char* title, address_t address, bool bounceable) {
-    // Configure
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryAddress;
-    hints->hints[hints->hints_count].address.address = address;
-    hints->hints[hints->hints_count].address.bounceable = bounceable;
+bool add_hint_address(HintHolder_t* hints, const char* title, address_t address, bool bounceable) {
+    uint8_t* data = add_record(hints, title, SummaryAddress, 2 + HASH_LEN);
+    if (data == NULL) {
+        return false;
+    }
+    data[0] = address.chain;
+    memcpy(data + 1, address.hash, HASH_LEN);
+    data[1 + HASH_LEN] = bounceable;
 
-    // Next
-    hints->hints_count++;
+    return true;
 }
 
-void add_hint_number(HintHolder_t* hints, const char* title, uint64_t number) {
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryNumber;
-    hints->hints[hints->hints_count].number = number;
+bool add_hint_number(HintHolder_t* hints, const char* title, uint64_t number) {
+    uint8_t* data = add_record(hints, title, SummaryNumber, sizeof(number));
+    if (data == NULL) {
+        return false;
+    }
+    memcpy(data, &number, sizeof(number));
 
-    // Next
-    hints->hints_count++;
+    return true;
 }
 
-void add_hint_bool(HintHolder_t* hints, const char* title, bool value) {
-    hints->hints[hints->hints_count].title = title;
-    hints->hints[hints->hints_count].kind = SummaryBool;
-    hints->hints[hints->hints_count].bool_value = value;
+bool add_hint_bool(HintHolder_t* hints, const char* title, bool value) {
+    uint8_t* data = add_record(hints, title, SummaryBool, 1);
+    if (data == NULL) {
+        return false;
+    }
+    data[0] = value;
 
-    // Next
-    hints->hints_count++;
+    return true;
+}
+
+bool get_hint(const HintHolder_t* hints, uint8_t index, Hint_t* hint) {
+    if (index >= hints->hints_count) {
+        return false;
+    }
+
+    const uint8_t* record = hints->data + record_offset(hints, index);
+    const uint8_t* data = record + HINT_HEADER_LEN;
+    uint8_t data_len = record[1];
+
+    memset(hint, 0, sizeof(*hint));
+    hint->kind = (enum HintKind) record[0];
+    memcpy(&hint->title, record + 2, sizeof(hint->title));
+
+    switch (hint->kind) {
+        case SummaryItemString: {
+            uint16_t len;
+            memcpy(&hint->string.string, data, sizeof(hint->string.string));
+            memcpy(&len, data + sizeof(hint->string.string), sizeof(len));
+            hint->string.length = len;
+            break;
+        }
+        case SummaryHash:
+            hint->hash = data;
+            break;
+        case SummaryHex:
+            hint->hex.data = data;
+            hint->hex.len = data_len;
+            break;
+        case SummaryItemAmount:
+            hint->amount.decimals = data[0];
+            memcpy(&hint->amount.ticker, data + 1, sizeof(hint->amount.ticker));
+            hint->amount.value = data + 1 + sizeof(hint->amount.ticker);
+            hint->amount.value_len = data_len - 1 - sizeof(hint->amount.ticker);
+            break;
+        case SummaryAddress:
+            hint->address.address.chain = data[0];
+            memcpy(hint->address.address.hash, data + 1, HASH_LEN);
+            hint->address.bounceable = data[1 + HASH_LEN];
+            break;
+        case SummaryNumber:
+            memcpy(&hint->number, data, sizeof(hint->number));
+            break;
+        case SummaryBool:
+            hint->bool_value = data[0];
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+void move_hints_before(HintHolder_t* hints, uint8_t start, uint8_t count) {
+    if (count == 0 || start + count > hints->hints_count) {
+        return;
+    }
+
+    // Rotate the records in place: reversing both parts then the whole range
+    uint16_t from = record_offset(hints, start);
+    uint16_t tail = record_offset(hints, hints->hints_count - count);
+    reverse_bytes(hints->data + from, tail - from);
+    reverse_bytes(hints->data + tail, hints->data_len - tail);
+    reverse_bytes(hints->data + from, hints->data_len - from);
 }
 
 int print_string(const char* in, char* out, size_t out_length) {
@@ -131,7 +272,15 @@ void print_hint(HintHolder_t* hints,
                 size_t title_len,
                 char* body,
                 size_t body_len) {
-    Hint_t hint = hints->hints[index];
+    Hint_t hint;
+
+    if (!get_hint(hints, index, &hint)) {
+        print_string("<unknown>", title, title_len);
+        print_string("<unknown>", body, body_len);
+        return;
+    }
+
+    PROFILE_BEGIN(PROFILE_UI);
 
     // Title
     print_string(hint.title, title, title_len);
@@ -149,21 +298,19 @@ void print_hint(HintHolder_t* hints,
                        body,
                        body_len);
     } else if (hint.kind == SummaryAddress) {
-        uint8_t address[ADDRESS_LEN] = {0};
-        address_to_friendly(hint.address.address.chain,
-                            hint.address.address.hash,
-                            hint.address.bounceable,
-                            false,
-                            address,
-                            sizeof(address));
         memset(body, 0, body_len);
-        base64_encode(address, sizeof(address), body, body_len);
+        address_to_friendly_base64(hint.address.address.chain,
+                                   hint.address.address.hash,
+                                   hint.address.bounceable,
+                                   false,
+                                   body,
+                                   body_len);
     } else if (hint.kind == SummaryNumber) {
         format_u64(hint.number, body, body_len);
     } else if (hint.kind == SummaryBool) {
         snprintf(body, body_len, hint.bool_value ? "Yes" : "No");
     } else if (hint.kind == SummaryHex) {
-        if (body_len >= 3 + 2 * hint.hex.len) {
+        if (body_len >= 3 + 2 * (size_t) hint.hex.len) {
             body[0] = '0';
             body[1] = 'x';
             format_hex(hint.hex.data, hint.hex.len, &body[2], body_len - 2);
@@ -171,4 +318,6 @@ void print_hint(HintHolder_t* hints,
     } else {
         print_string("<unknown>", body, body_len);
     }
+
+    PROFILE_END(PROFILE_UI);
 }
@@ -24,8 +24,8 @@ typedef struct {
 } SizedString_t;
 
 typedef struct {
-    char ticker[MAX_TICKER_LEN + 1];
-    uint8_t value[MAX_VALUE_BYTES_LEN];
+    const char* ticker;    // zero terminated ticker
+    const uint8_t* value;  // big endian value
     uint8_t value_len;
     uint8_t decimals;
 } Amount_t;
@@ -37,9 +37,13 @@ typedef struct {
 
 typedef struct {
     uint8_t len;
-    uint8_t data[HASH_LEN];
+    const uint8_t* data;
 } HintHex_t;
 
+/**
+ * Hint decoded from its record, strings, values and hashes point into the record or
+ * into the data the hint was added from.
+ */
 typedef struct {
     const char* title;
     enum HintKind kind;
@@ -47,30 +51,76 @@ typedef struct {
         Amount_t amount;
         uint64_t number;
         SizedString_t string;
-        uint8_t hash[HASH_LEN];
+        const uint8_t* hash;
         HintAddress_t address;
         bool bool_value;
         HintHex_t hex;
     };
 } Hint_t;
 
+/**
+ * Length of the header of a hint record: kind, length of data and title.
+ */
+#define HINT_HEADER_LEN (2 + sizeof(const char*))
+
+/**
+ * Max length of a hint record, the one of an address.
+ */
+#define HINT_MAX_RECORD_LEN (HINT_HEADER_LEN + 2 + HASH_LEN)
+
+/**
+ * Hints packed as records of a header followed by data whose length depends on the kind.
+ * Titles, texts and tickers are not copied, they must outlive the holder. A zeroed
+ * holder is empty.
+ */
 typedef struct {
-    Hint_t hints[MAX_HINTS];
-    uint8_t hints_count;
+    uint8_t data[HINTS_ARENA_LEN];  // hint records
+    uint16_t data_len;              // bytes of records in data
+    uint8_t hints_count;            // number of records
 } HintHolder_t;
 
-void add_hint_text(HintHolder_t* hints, const char* title, const char* text, size_t text_len);
-void add_hint_hash(HintHolder_t* hints, const char* title, uint8_t* data);
-void add_hint_amount(HintHolder_t* hints,
+/**
+ * Remove all hints.
+ */
+void clear_hints(HintHolder_t* hints);
+
+/**
+ * Remove the hints from index count onwards.
+ */
+void truncate_hints(HintHolder_t* hints, uint8_t count);
+
+/**
+ * Check that count hints of any kind can be added.
+ */
+bool hints_fit(const HintHolder_t* hints, uint8_t count);
+
+/**
+ * Add a hint, the add_hint_* functions return false if it does not fit.
+ */
+bool add_hint_text(HintHolder_t* hints, const char* title, const char* text, size_t text_len);
+bool add_hint_hash(HintHolder_t* hints, const char* title, const uint8_t* data);
+bool add_hint_amount(HintHolder_t* hints,
                      const char* title,
                      const char* ticker,
-                     uint8_t* value,
+                     const uint8_t* value,
                      uint8_t value_len,
                      uint8_t decimals);
-void add_hint_address(HintHolder_t* hints, const char* title, address_t address, bool bounceable);
-void add_hint_number(HintHolder_t* hints, const char* title, uint64_t number);
-void add_hint_bool(HintHolder_t* hints, const char* title, bool value);
-void add_hint_hex(HintHolder_t* hints, const char* title, uint8_t* data, uint8_t data_len);
+bool add_hint_address(HintHolder_t* hints, const char* title, address_t address, bool bounceable);
+bool add_hint_number(HintHolder_t* hints, const char* title, uint64_t number);
+bool add_hint_bool(HintHolder_t* hints, const char* title, bool value);
+bool add_hint_hex(HintHolder_t* hints, const char* title, const uint8_t* data, uint8_t data_len);
+
+/**
+ * Decode the hint at index.
+ *
+ * @return true if success, false if there is no such hint.
+ */
+bool get_hint(const HintHolder_t* hints, uint8_t index, Hint_t* hint);
+
+/**
+ * Move the last count hints in front of the hints starting at index start.
+ */
+void move_hints_before(HintHolder_t* hints, uint8_t start, uint8_t count);
 
 void print_hint(HintHolder_t* hints,
                 uint16_t index,
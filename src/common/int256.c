@@ -5,18 +5,39 @@
 
 #include "int256.h"
 
+/**
+ * Max number of digits written by the conversion: 78 digits of 2^256 - 1, rounded up to
+ * whole groups of 4 digits.
+ */
+#define INT256_MAX_DIGITS 80
+
+/**
+ * Write the decimal digits of a number below 2^64 before position pos.
+ *
+ * @return position of the first digit.
+ */
+static size_t u64_to_digits(uint64_t n, char *digits, size_t pos) {
+    while (n != 0) {
+        digits[--pos] = '0' + (char) (n % 10);
+        n /= 10;
+    }
+    return pos;
+}
+
 bool uint256_to_decimal(const uint8_t *value, size_t value_len, char *out, size_t out_len) {
     if (value_len > INT256_LENGTH) {
         // value len is bigger than INT256_LENGTH ?!
         return false;
     }
 
-    uint16_t n[16] = {0};
-    // Copy and right-align the number
-    memcpy((uint8_t *) n + INT256_LENGTH - value_len, value, value_len);
+    // Leading zero bytes do not change the value
+    while (value_len > 0 && value[0] == 0) {
+        value++;
+        value_len--;
+    }
 
     // Special case when value is 0
-    if (allzeroes(n, INT256_LENGTH)) {
+    if (value_len == 0) {
         if (out_len < 2) {
             // Not enough space to hold "0" and \0.
             return false;
@@ -25,25 +46,59 @@ bool uint256_to_decimal(const uint8_t *value, size_t value_len, char *out, size_
         return true;
     }
 
-    uint16_t *p = n;
-    for (int i = 0; i < 16; i++) {
-        n[i] = __builtin_bswap16(*p++);
-    }
-    int pos = out_len;
-    while (!allzeroes(n, sizeof(n))) {
-        if (pos == 0) {
-            return false;
+    char digits[INT256_MAX_DIGITS];
+    size_t pos = sizeof(digits);
+
+    if (value_len <= sizeof(uint64_t)) {
+        // Fast path, amounts of Toncoin and most jettons fit in 64 bits
+        uint64_t n = 0;
+        for (size_t i = 0; i < value_len; i++) {
+            n = (n << 8) | value[i];
+        }
+        pos = u64_to_digits(n, digits, pos);
+    } else {
+        // Big endian 16-bit limbs, the first one may hold a single byte
+        uint16_t n[INT256_LENGTH / 2];
+        size_t limbs = (value_len + 1) / 2;
+        size_t offset = 0;
+        if (value_len % 2 != 0) {
+            n[0] = value[0];
+            offset = 1;
         }
-        pos -= 1;
-        unsigned int carry = 0;
-        for (int i = 0; i < 16; i++) {
-            int rem = ((carry << 16) | n[i]) % 10;
-            n[i] = ((carry << 16) | n[i]) / 10;
-            carry = rem;
+        for (size_t i = value_len % 2; i < limbs; i++, offset += 2) {
+            n[i] = (uint16_t) ((value[offset] << 8) | value[offset + 1]);
+        }
+
+        // Divide by 10^4 per pass, limbs above the highest non-zero one are skipped
+        size_t top = 0;
+        while (top < limbs) {
+            uint32_t rem = 0;
+            for (size_t i = top; i < limbs; i++) {
+                uint32_t cur = (rem << 16) | n[i];
+                n[i] = (uint16_t) (cur / 10000);
+                rem = cur % 10000;
+            }
+            while (top < limbs && n[top] == 0) {
+                top++;
+            }
+            for (int i = 0; i < 4; i++) {
+                digits[--pos] = '0' + (char) (rem % 10);
+                rem /= 10;
+            }
+        }
+
+        // The last group may start with zeroes
+        while (digits[pos] == '0') {
+            pos++;
         }
-        out[pos] = '0' + carry;
     }
-    memmove(out, out + pos, out_len - pos);
-    out[out_len - pos] = 0;
+
+    size_t len = sizeof(digits) - pos;
+    if (len + 1 > out_len) {
+        return false;
+    }
+    memcpy(out, digits + pos, len);
+    out[len] = '\0';
+
     return true;
-}
\ No newline at end of file
+}
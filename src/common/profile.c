@@ -0,0 +1,46 @@
+#ifdef HAVE_PROFILE
+
+#include <stdint.h>  // uint*_t
+#include <string.h>  // memset
+
+#ifndef OS_IO_SEPROXYHAL
+#include <time.h>  // clock_gettime
+#endif
+
+#include "profile.h"
+
+profile_t G_profile;
+
+#ifdef OS_IO_SEPROXYHAL
+
+// BOLOS gives applications no cycle counter, only calls are counted on the device
+const uint32_t PROFILE_TICKS_PER_SECOND = 0;
+
+uint64_t profile_ticks(void) {
+    return 0;
+}
+
+#else
+
+const uint32_t PROFILE_TICKS_PER_SECOND = 1000000000;
+
+uint64_t profile_ticks(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+#endif
+
+void profile_add(profile_phase_e phase, uint64_t start) {
+    G_profile.phases[phase].ticks += profile_ticks() - start;
+    G_profile.phases[phase].calls++;
+}
+
+void profile_reset(void) {
+    memset(&G_profile, 0, sizeof(G_profile));
+}
+
+#endif
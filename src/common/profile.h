@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdint.h>  // uint*_t
+
+/**
+ * Phases of a request timed by the profiler. Phases nest: the ticks of a phase include
+ * those of the phases it calls, e.g. PROFILE_HINTS is part of PROFILE_DESERIALIZE.
+ */
+typedef enum {
+    PROFILE_APDU,         /// parsing APDUs
+    PROFILE_DESERIALIZE,  /// parsing requests
+    PROFILE_HINTS,        /// building the hints of messages
+    PROFILE_HASH,         /// hashing transaction requests
+    PROFILE_UI,           /// formatting hints for display
+    PROFILE_DERIVE,       /// deriving private keys
+    PROFILE_SIGN,         /// signing
+    PROFILE_PHASES_COUNT
+} profile_phase_e;
+
+/**
+ * Events counted by the profiler.
+ */
+typedef enum {
+    PROFILE_HASH_CELL,  /// cells hashed
+    PROFILE_CX_HASH,    /// cx_hash calls
+    PROFILE_COUNTERS_COUNT
+} profile_counter_e;
+
+#ifdef HAVE_PROFILE
+
+typedef struct {
+    uint64_t ticks;  /// ticks spent in the phase
+    uint32_t calls;  /// times the phase was entered
+} profile_phase_t;
+
+typedef struct {
+    profile_phase_t phases[PROFILE_PHASES_COUNT];
+    uint32_t counters[PROFILE_COUNTERS_COUNT];
+} profile_t;
+
+/**
+ * Totals since the app started or the profile was last reset.
+ */
+extern profile_t G_profile;
+
+/**
+ * Ticks per second of profile_ticks(), zero if no tick source is available and only
+ * calls are counted.
+ */
+extern const uint32_t PROFILE_TICKS_PER_SECOND;
+
+/**
+ * Current value of the tick source.
+ */
+uint64_t profile_ticks(void);
+
+/**
+ * Add a call to phase started at tick start.
+ */
+void profile_add(profile_phase_e phase, uint64_t start);
+
+/**
+ * Clear all totals.
+ */
+void profile_reset(void);
+
+#define PROFILE_BEGIN(PHASE) uint64_t profile_start_##PHASE = profile_ticks()
+#define PROFILE_END(PHASE)   profile_add(PHASE, profile_start_##PHASE)
+#define PROFILE_COUNT(COUNTER) G_profile.counters[COUNTER]++
+
+#else
+
+#define PROFILE_BEGIN(PHASE)
+#define PROFILE_END(PHASE)
+#define PROFILE_COUNT(COUNTER)
+
+#endif
@@ -0,0 +1,95 @@
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memcmp, memmove, explicit_bzero
+
+#include "pubkey_cache.h"
+
+typedef struct {
+    uint32_t bip32_path[MAX_BIP32_PATH];
+    uint8_t bip32_path_len;  // 0 if the slot is empty
+    uint8_t public_key[PUBKEY_LEN];
+    bool has_hash;
+    uint8_t hash[HASH_LEN];
+} pubkey_cache_entry_t;
+
+/**
+ * Slots ordered from the most recently used to the least recently used.
+ */
+static pubkey_cache_entry_t g_pubkey_cache[PUBKEY_CACHE_SLOTS];
+
+/**
+ * Move a slot to the front, keeping the order of the others.
+ */
+static pubkey_cache_entry_t *touch(uint8_t slot) {
+    if (slot > 0) {
+        pubkey_cache_entry_t entry = g_pubkey_cache[slot];
+        memmove(&g_pubkey_cache[1], &g_pubkey_cache[0], slot * sizeof(pubkey_cache_entry_t));
+        g_pubkey_cache[0] = entry;
+        explicit_bzero(&entry, sizeof(entry));
+    }
+
+    return &g_pubkey_cache[0];
+}
+
+bool pubkey_cache_find(const uint32_t *bip32_path,
+                       uint8_t bip32_path_len,
+                       uint8_t public_key[static PUBKEY_LEN]) {
+    if (bip32_path_len == 0 || bip32_path_len > MAX_BIP32_PATH) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < PUBKEY_CACHE_SLOTS; i++) {
+        if (g_pubkey_cache[i].bip32_path_len == bip32_path_len &&
+            memcmp(g_pubkey_cache[i].bip32_path,
+                   bip32_path,
+                   bip32_path_len * sizeof(uint32_t)) == 0) {
+            memmove(public_key, touch(i)->public_key, PUBKEY_LEN);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void pubkey_cache_add(const uint32_t *bip32_path,
+                      uint8_t bip32_path_len,
+                      const uint8_t public_key[static PUBKEY_LEN]) {
+    if (bip32_path_len == 0 || bip32_path_len > MAX_BIP32_PATH) {
+        return;
+    }
+
+    // The least recently used slot is overwritten
+    pubkey_cache_entry_t *entry = touch(PUBKEY_CACHE_SLOTS - 1);
+    explicit_bzero(entry, sizeof(pubkey_cache_entry_t));
+    memmove(entry->bip32_path, bip32_path, bip32_path_len * sizeof(uint32_t));
+    entry->bip32_path_len = bip32_path_len;
+    memmove(entry->public_key, public_key, PUBKEY_LEN);
+}
+
+bool pubkey_cache_find_hash(const uint8_t public_key[static PUBKEY_LEN],
+                            uint8_t hash[static HASH_LEN]) {
+    for (uint8_t i = 0; i < PUBKEY_CACHE_SLOTS; i++) {
+        if (g_pubkey_cache[i].bip32_path_len != 0 && g_pubkey_cache[i].has_hash &&
+            memcmp(g_pubkey_cache[i].public_key, public_key, PUBKEY_LEN) == 0) {
+            memmove(hash, touch(i)->hash, HASH_LEN);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void pubkey_cache_add_hash(const uint8_t public_key[static PUBKEY_LEN],
+                           const uint8_t hash[static HASH_LEN]) {
+    for (uint8_t i = 0; i < PUBKEY_CACHE_SLOTS; i++) {
+        if (g_pubkey_cache[i].bip32_path_len != 0 &&
+            memcmp(g_pubkey_cache[i].public_key, public_key, PUBKEY_LEN) == 0) {
+            memmove(g_pubkey_cache[i].hash, hash, HASH_LEN);
+            g_pubkey_cache[i].has_hash = true;
+        }
+    }
+}
+
+void pubkey_cache_clear(void) {
+    explicit_bzero(g_pubkey_cache, sizeof(g_pubkey_cache));
+}
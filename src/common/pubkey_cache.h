@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "bip32.h"
+#include "../constants.h"
+
+/**
+ * Number of public keys kept, the least recently used one is evicted first.
+ */
+#ifdef TARGET_NANOS
+#define PUBKEY_CACHE_SLOTS 2
+#else
+#define PUBKEY_CACHE_SLOTS 4
+#endif
+
+/**
+ * Find the public key derived from a BIP32 path during this session.
+ *
+ * @param[in]  bip32_path
+ *   Pointer to buffer with BIP32 path.
+ * @param[in]  bip32_path_len
+ *   Number of path in BIP32 path.
+ * @param[out] public_key
+ *   Pointer to raw public key, written if found.
+ *
+ * @return true if found, false otherwise.
+ *
+ */
+bool pubkey_cache_find(const uint32_t *bip32_path,
+                       uint8_t bip32_path_len,
+                       uint8_t public_key[static PUBKEY_LEN]);
+
+/**
+ * Keep the public key derived from a BIP32 path.
+ *
+ * @param[in] bip32_path
+ *   Pointer to buffer with BIP32 path.
+ * @param[in] bip32_path_len
+ *   Number of path in BIP32 path.
+ * @param[in] public_key
+ *   Pointer to raw public key.
+ *
+ */
+void pubkey_cache_add(const uint32_t *bip32_path,
+                      uint8_t bip32_path_len,
+                      const uint8_t public_key[static PUBKEY_LEN]);
+
+/**
+ * Find the hash of the wallet address of a public key kept in the cache.
+ *
+ * @param[in]  public_key
+ *   Pointer to raw public key.
+ * @param[out] hash
+ *   Pointer to address hash, written if found.
+ *
+ * @return true if found, false otherwise.
+ *
+ */
+bool pubkey_cache_find_hash(const uint8_t public_key[static PUBKEY_LEN],
+                            uint8_t hash[static HASH_LEN]);
+
+/**
+ * Keep the hash of the wallet address of a public key, if the public key is in the cache.
+ *
+ * @param[in] public_key
+ *   Pointer to raw public key.
+ * @param[in] hash
+ *   Pointer to address hash.
+ *
+ */
+void pubkey_cache_add_hash(const uint8_t public_key[static PUBKEY_LEN],
+                           const uint8_t hash[static HASH_LEN]);
+
+/**
+ * Wipe all public keys and address hashes.
+ */
+void pubkey_cache_clear(void);
@@ -20,11 +20,6 @@
  */
 #define MAX_APPNAME_LEN 64
 
-/**
- * Maximum transaction length (bytes).
- */
-#define MAX_TRANSACTION_LEN 510
-
 /**
  * Signature length (bytes).
  */
@@ -73,7 +68,30 @@
 /**
  * Max hints in one transaction.
  */
-#define MAX_HINTS 8
+#ifdef TARGET_NANOS
+#define MAX_HINTS 16
+#else
+#define MAX_HINTS 48
+#endif
+
+/**
+ * Length of the records of the hints of one transaction or signed data (bytes). Enough for
+ * 8 (32 on other devices) hints of any kind, hints usually take half of that.
+ */
+#ifdef TARGET_NANOS
+#define HINTS_ARENA_LEN 320
+#else
+#define HINTS_ARENA_LEN 1280
+#endif
+
+/**
+ * Max total length of hints data of the messages of one transaction (bytes).
+ */
+#ifdef TARGET_NANOS
+#define MAX_HINTS_DATA_LEN 192
+#else
+#define MAX_HINTS_DATA_LEN 384
+#endif
 
 /**
  * Maximum signed data length (bytes).
@@ -90,6 +108,11 @@
  */
 #define DEFAULT_SUBWALLET_ID 698983191
 
+/**
+ * Default wallet id of wallets v5 on mainnet workchain 0, which will not be displayed.
+ */
+#define DEFAULT_W5_WALLET_ID 0x7FFFFF11
+
 /**
  * Max length for cell_inline types
  */
@@ -27,82 +27,96 @@
 
 #include "constants.h"
 #include "globals.h"
+#include "common/pubkey_cache.h"
 #include "common/write.h"
-
-static int crypto_sign(const uint32_t *bip32_path,
-                       uint8_t bip32_path_len,
-                       const uint8_t *data,
-                       size_t data_len,
-                       uint8_t *sig,
-                       size_t sig_len) {
-    cx_ecfp_private_key_t private_key = {0};
+#include "common/profile.h"
+
+/**
+ * Derive the Ed25519 private key of a BIP32 path.
+ */
+static int crypto_derive_private_key(const uint32_t *bip32_path,
+                                     uint8_t bip32_path_len,
+                                     cx_ecfp_private_key_t *private_key) {
     uint8_t raw_private_key[PRIVKEY_LEN] = {0};
 
-    if (os_derive_bip32_with_seed_no_throw(HDW_ED25519_SLIP10,
-                                           CX_CURVE_Ed25519,
-                                           bip32_path,
-                                           bip32_path_len,
-                                           raw_private_key,
-                                           NULL,
-                                           (unsigned char *) "ed25519 seed",
-                                           12) != CX_OK) {
+    PROFILE_BEGIN(PROFILE_DERIVE);
+    cx_err_t err = os_derive_bip32_with_seed_no_throw(HDW_ED25519_SLIP10,
+                                                      CX_CURVE_Ed25519,
+                                                      bip32_path,
+                                                      bip32_path_len,
+                                                      raw_private_key,
+                                                      NULL,
+                                                      (unsigned char *) "ed25519 seed",
+                                                      12);
+    PROFILE_END(PROFILE_DERIVE);
+    if (err != CX_OK) {
         explicit_bzero(&raw_private_key, sizeof(raw_private_key));
         return -1;
     }
 
-    if (cx_ecfp_init_private_key_no_throw(CX_CURVE_Ed25519, raw_private_key, 32, &private_key) !=
+    if (cx_ecfp_init_private_key_no_throw(CX_CURVE_Ed25519, raw_private_key, 32, private_key) !=
         CX_OK) {
-        explicit_bzero(&private_key, sizeof(private_key));
+        explicit_bzero(private_key, sizeof(*private_key));
         explicit_bzero(&raw_private_key, sizeof(raw_private_key));
         return -1;
     }
 
     explicit_bzero(&raw_private_key, sizeof(raw_private_key));
 
-    if (cx_eddsa_sign_no_throw(&private_key, CX_SHA512, data, data_len, sig, sig_len) != CX_OK) {
-        explicit_bzero(&private_key, sizeof(private_key));
+    return 0;
+}
+
+static int crypto_sign_with_key(const cx_ecfp_private_key_t *private_key,
+                                const uint8_t *data,
+                                size_t data_len,
+                                uint8_t *sig,
+                                size_t sig_len) {
+    PROFILE_BEGIN(PROFILE_SIGN);
+    cx_err_t err = cx_eddsa_sign_no_throw(private_key, CX_SHA512, data, data_len, sig, sig_len);
+    PROFILE_END(PROFILE_SIGN);
+    if (err != CX_OK) {
         return -1;
     }
 
-    explicit_bzero(&private_key, sizeof(private_key));
-
     return 0;
 }
 
-int crypto_derive_public_key(const uint32_t *bip32_path,
-                             uint8_t bip32_path_len,
-                             uint8_t raw_public_key[static PUBKEY_LEN]) {
+static int crypto_sign(const uint32_t *bip32_path,
+                       uint8_t bip32_path_len,
+                       const uint8_t *data,
+                       size_t data_len,
+                       uint8_t *sig,
+                       size_t sig_len) {
     cx_ecfp_private_key_t private_key = {0};
-    uint8_t raw_private_key[PRIVKEY_LEN] = {0};
-    cx_ecfp_public_key_t public_key = {0};
 
-    if (os_derive_bip32_with_seed_no_throw(HDW_ED25519_SLIP10,
-                                           CX_CURVE_Ed25519,
-                                           bip32_path,
-                                           bip32_path_len,
-                                           raw_private_key,
-                                           NULL,
-                                           (unsigned char *) "ed25519 seed",
-                                           12) != CX_OK) {
-        explicit_bzero(&raw_private_key, sizeof(raw_private_key));
+    if (crypto_derive_private_key(bip32_path, bip32_path_len, &private_key) < 0) {
         return -1;
     }
 
-    if (cx_ecfp_init_private_key_no_throw(CX_CURVE_Ed25519, raw_private_key, 32, &private_key) !=
-        CX_OK) {
+    if (crypto_sign_with_key(&private_key, data, data_len, sig, sig_len) < 0) {
         explicit_bzero(&private_key, sizeof(private_key));
-        explicit_bzero(&raw_private_key, sizeof(raw_private_key));
         return -1;
     }
 
-    explicit_bzero(&raw_private_key, sizeof(raw_private_key));
+    explicit_bzero(&private_key, sizeof(private_key));
 
-    if (cx_ecfp_generate_pair_no_throw(CX_CURVE_Ed25519, &public_key, &private_key, 1) != CX_OK) {
-        explicit_bzero(&private_key, sizeof(private_key));
+    return 0;
+}
+
+int crypto_derive_key_pair(const uint32_t *bip32_path,
+                           uint8_t bip32_path_len,
+                           cx_ecfp_private_key_t *private_key,
+                           uint8_t raw_public_key[static PUBKEY_LEN]) {
+    cx_ecfp_public_key_t public_key = {0};
+
+    if (crypto_derive_private_key(bip32_path, bip32_path_len, private_key) < 0) {
         return -1;
     }
 
-    explicit_bzero(&private_key, sizeof(private_key));
+    if (cx_ecfp_generate_pair_no_throw(CX_CURVE_Ed25519, &public_key, private_key, 1) != CX_OK) {
+        explicit_bzero(private_key, sizeof(*private_key));
+        return -1;
+    }
 
     // Convert to NaCL format
     for (int i = 0; i < PUBKEY_LEN; i++) {
@@ -114,9 +128,27 @@ int crypto_derive_public_key(const uint32_t *bip32_path,
 
     explicit_bzero(&public_key, sizeof(public_key));
 
+    pubkey_cache_add(bip32_path, bip32_path_len, raw_public_key);
+
     return 0;
 }
 
+int crypto_derive_public_key(const uint32_t *bip32_path,
+                             uint8_t bip32_path_len,
+                             uint8_t raw_public_key[static PUBKEY_LEN]) {
+    cx_ecfp_private_key_t private_key = {0};
+
+    if (pubkey_cache_find(bip32_path, bip32_path_len, raw_public_key)) {
+        return 0;
+    }
+
+    int ret = crypto_derive_key_pair(bip32_path, bip32_path_len, &private_key, raw_public_key);
+
+    explicit_bzero(&private_key, sizeof(private_key));
+
+    return ret;
+}
+
 int crypto_sign_tx() {
     if (crypto_sign(G_context.bip32_path,
                     G_context.bip32_path_len,
@@ -131,16 +163,15 @@ int crypto_sign_tx() {
 }
 
 int crypto_sign_proof() {
-    if (crypto_sign(G_context.bip32_path,
-                    G_context.bip32_path_len,
-                    G_context.proof_info.hash,
-                    sizeof(G_context.proof_info.hash),
-                    G_context.proof_info.signature,
-                    sizeof(G_context.proof_info.signature)) < 0) {
-        return -1;
-    }
+    int ret = crypto_sign_with_key(&G_context.proof_info.private_key,
+                                   G_context.proof_info.hash,
+                                   sizeof(G_context.proof_info.hash),
+                                   G_context.proof_info.signature,
+                                   sizeof(G_context.proof_info.signature));
 
-    return 0;
+    explicit_bzero(&G_context.proof_info.private_key, sizeof(G_context.proof_info.private_key));
+
+    return ret;
 }
 
 int crypto_sign_sign_data() {
@@ -160,3 +191,11 @@ int crypto_sign_sign_data() {
 
     return 0;
 }
+
+int crypto_sign_batch_order() {
+    return crypto_sign_with_key(&G_context.batch_info.private_key,
+                                G_context.batch_info.order.m_hash,
+                                sizeof(G_context.batch_info.order.m_hash),
+                                G_context.batch_info.order.signature,
+                                sizeof(G_context.batch_info.order.signature));
+}
@@ -2,10 +2,13 @@
 
 #include <stdint.h>  // uint*_t
 
+#include "cx.h"
+
 #include "constants.h"
 
 /**
- * Initialize public key given bip32 path.
+ * Initialize public key given bip32 path. Public keys derived during the session
+ * are kept in a cache, a path derived recently is not derived again.
  *
  * @param[in]  bip32_path
  *   Pointer to buffer with BIP32 path.
@@ -21,6 +24,27 @@ int crypto_derive_public_key(const uint32_t *bip32_path,
                              uint8_t bip32_path_len,
                              uint8_t raw_public_key[static PUBKEY_LEN]);
 
+/**
+ * Derive private key and public key given bip32 path, so that a signature following a
+ * review does not derive the key again. The private key must be wiped once used.
+ *
+ * @param[in]  bip32_path
+ *   Pointer to buffer with BIP32 path.
+ * @param[in]  bip32_path_len
+ *   Number of path in BIP32 path.
+ * @param[out] private_key
+ *   Pointer to private key.
+ * @param[out] raw_public_key
+ *   Pointer to raw public key.
+ *
+ * @return 0 if success, -1 otherwise.
+ *
+ */
+int crypto_derive_key_pair(const uint32_t *bip32_path,
+                           uint8_t bip32_path_len,
+                           cx_ecfp_private_key_t *private_key,
+                           uint8_t raw_public_key[static PUBKEY_LEN]);
+
 /**
  * Sign tx hash in global context.
  *
@@ -33,9 +57,10 @@ int crypto_derive_public_key(const uint32_t *bip32_path,
 int crypto_sign_tx(void);
 
 /**
- * Sign proof hash in global context.
+ * Sign proof hash in global context with the private key derived when the proof
+ * was parsed, the private key is wiped.
  *
- * @see G_context.bip32_path, G_context.proof_info.hash,
+ * @see G_context.proof_info.private_key, G_context.proof_info.hash,
  * G_context.proof_info.signature.
  *
  * @return 0 if success, -1 otherwise.
@@ -54,3 +79,15 @@ int crypto_sign_proof(void);
  *
  */
 int crypto_sign_sign_data(void);
+
+/**
+ * Sign hash of the batch transaction in global context with the private key derived
+ * when the batch was reviewed.
+ *
+ * @see G_context.batch_info.private_key, G_context.batch_info.order.m_hash,
+ * G_context.batch_info.order.signature.
+ *
+ * @return 0 if success, -1 otherwise.
+ *
+ */
+int crypto_sign_batch_order(void);
@@ -0,0 +1,168 @@
+#ifdef HAVE_DRY_RUN
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // memcpy, strnlen, explicit_bzero
+
+#include "os.h"
+
+#include "dry_run.h"
+#include "../sw.h"
+#include "../io.h"
+#include "../globals.h"
+#include "../common/buffer.h"
+#include "../common/hints.h"
+#include "../sign_data/sign_data_deserialize.h"
+#include "../transaction/types.h"
+#include "../transaction/deserialize.h"
+#include "../transaction/request.h"
+
+/**
+ * Max length of a title or an action in a response.
+ */
+#define DRY_RUN_TITLE_LEN 32
+
+/**
+ * Max length of a formatted hint value in a response.
+ */
+#define DRY_RUN_VALUE_LEN 200
+
+static size_t put_string(uint8_t *out, const char *string, size_t max_len) {
+    size_t len = strnlen(string, max_len);
+
+    out[0] = (uint8_t) len;
+    memcpy(out + 1, string, len);
+
+    return 1 + len;
+}
+
+/**
+ * Send what would be reviewed:
+ *
+ * response = hash (HASH_LEN) || is_blind (1) || hints_count (1) ||
+ *            len(title) (1) || title || len(action) (1) || action
+ */
+static int send_dry_run_result(const uint8_t *hash,
+                               bool is_blind,
+                               uint8_t hints_count,
+                               const char *title,
+                               const char *action) {
+    uint8_t resp[HASH_LEN + 2 + 2 * (1 + DRY_RUN_TITLE_LEN)];
+    size_t offset = 0;
+
+    memcpy(resp, hash, HASH_LEN);
+    offset += HASH_LEN;
+    resp[offset++] = is_blind;
+    resp[offset++] = hints_count;
+    offset += put_string(resp + offset, title, DRY_RUN_TITLE_LEN);
+    offset += put_string(resp + offset, action, DRY_RUN_TITLE_LEN);
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+}
+
+static int dry_run_transaction(buffer_t *cdata, bool more) {
+    transaction_ctx_t *ctx = &G_context.tx_info;
+
+    parser_status_e status = request_deserialize_chunk(cdata, &ctx->transaction, !more);
+    PRINTF("Parsing status: %d.\n", status);
+    if (status != PARSING_OK || (!more && !request_hash(ctx))) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_TX_PARSING_FAIL);
+    }
+
+    if (more) {
+        return io_send_sw(SW_OK);
+    }
+
+    G_context.state = STATE_PARSED;
+
+    return send_dry_run_result(ctx->m_hash,
+                               ctx->transaction.is_blind,
+                               ctx->transaction.hints.hints_count,
+                               ctx->transaction.title,
+                               ctx->transaction.action);
+}
+
+static int dry_run_sign_data(buffer_t *cdata, bool more) {
+    sign_data_ctx_t *ctx = &G_context.sign_data_info;
+    size_t chunk_offset = ctx->raw_data_len;
+
+    if (ctx->raw_data_len + cdata->size > MAX_DATA_LEN ||
+        !buffer_move(cdata, &ctx->raw_data[ctx->raw_data_len], cdata->size)) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_WRONG_SIGN_DATA_LENGTH);
+    }
+    ctx->raw_data_len += cdata->size;
+
+    if (!sign_data_check_chunk(ctx->raw_data, ctx->raw_data_len, chunk_offset)) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_SIGN_DATA_PARSING_FAIL);
+    }
+
+    if (more) {
+        return io_send_sw(SW_OK);
+    }
+
+    buffer_t buf = {.ptr = ctx->raw_data, .size = ctx->raw_data_len, .offset = 0};
+    if (!sign_data_deserialize(&buf, ctx)) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_SIGN_DATA_PARSING_FAIL);
+    }
+
+    G_context.state = STATE_PARSED;
+
+    return send_dry_run_result(ctx->cell_hash, false, ctx->hints.hints_count, "", "");
+}
+
+int handler_dry_run(bool sign_data, buffer_t *cdata, bool first, bool more) {
+    request_type_e req_type = sign_data ? DRY_RUN_SIGN_DATA : DRY_RUN_TRANSACTION;
+
+    if (first) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        G_context.req_type = req_type;
+        G_context.state = STATE_NONE;
+        if (!sign_data) {
+            transaction_deserialize_init(&G_context.tx_info.transaction);
+        }
+    } else if (G_context.req_type != req_type || G_context.state != STATE_NONE) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    return sign_data ? dry_run_sign_data(cdata, more) : dry_run_transaction(cdata, more);
+}
+
+int handler_dry_run_hint(uint8_t index) {
+    HintHolder_t *hints;
+
+    if (G_context.state != STATE_PARSED) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+    if (G_context.req_type == DRY_RUN_TRANSACTION) {
+        hints = &G_context.tx_info.transaction.hints;
+    } else if (G_context.req_type == DRY_RUN_SIGN_DATA) {
+        hints = &G_context.sign_data_info.hints;
+    } else {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    Hint_t hint;
+    if (!get_hint(hints, index, &hint)) {
+        return io_send_sw(SW_WRONG_DATA_LENGTH);
+    }
+
+    // response = kind (1) || len(title) (1) || title || len(value) (1) || value
+    char title[DRY_RUN_TITLE_LEN];
+    char value[DRY_RUN_VALUE_LEN + 1];
+    uint8_t resp[1 + 1 + DRY_RUN_TITLE_LEN + 1 + DRY_RUN_VALUE_LEN];
+    size_t offset = 0;
+
+    print_hint(hints, index, title, sizeof(title), value, sizeof(value));
+    resp[offset++] = (uint8_t) hint.kind;
+    offset += put_string(resp + offset, title, DRY_RUN_TITLE_LEN);
+    offset += put_string(resp + offset, value, DRY_RUN_VALUE_LEN);
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+}
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#ifdef HAVE_DRY_RUN
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "../common/buffer.h"
+
+/**
+ * Handler for DRY_RUN command with P1_DRY_RUN_TRANSACTION or P1_DRY_RUN_SIGN_DATA. Parse
+ * and hash a request sent in chunks as with SIGN_TX or SIGN_DATA, without BIP32 path, and
+ * send what would be reviewed instead of starting the review. Nothing is signed.
+ *
+ * @param[in]     sign_data
+ *   Whether the request is custom data rather than a transaction.
+ * @param[in,out] cdata
+ *   Command data with a chunk of the request.
+ * @param[in]     first
+ *   Whether this is the first chunk or not.
+ * @param[in]     more
+ *   Whether more APDU chunks are to be received or not.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_dry_run(bool sign_data, buffer_t *cdata, bool first, bool more);
+
+/**
+ * Handler for DRY_RUN command with P1_DRY_RUN_HINT. Send a hint of the request of the
+ * last dry run, formatted as displayed.
+ *
+ * @param[in] index
+ *   Index of the hint.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_dry_run_hint(uint8_t index);
+
+#endif
@@ -29,6 +29,7 @@ int handler_get_address_proof(uint8_t flags, buffer_t *cdata) {
     explicit_bzero(&G_context, sizeof(G_context));
 
     if (!deserialize_proof(cdata, flags)) {
+        explicit_bzero(&G_context, sizeof(G_context));
         return 0;
     }
 
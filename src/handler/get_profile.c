@@ -0,0 +1,46 @@
+#ifdef HAVE_PROFILE
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+
+#include "get_profile.h"
+#include "../io.h"
+#include "../sw.h"
+#include "../common/buffer.h"
+#include "../common/profile.h"
+#include "../common/write.h"
+
+/**
+ * response = ticks_per_second (4) || phases_count (1) ||
+ *            phases_count * (ticks (8) || calls (4)) ||
+ *            counters_count (1) || counters_count * count (4)
+ */
+int handler_get_profile(bool reset) {
+    uint8_t resp[4 + 1 + PROFILE_PHASES_COUNT * 12 + 1 + PROFILE_COUNTERS_COUNT * 4];
+    size_t offset = 0;
+
+    write_u32_be(resp, offset, PROFILE_TICKS_PER_SECOND);
+    offset += 4;
+
+    resp[offset++] = PROFILE_PHASES_COUNT;
+    for (size_t i = 0; i < PROFILE_PHASES_COUNT; i++) {
+        write_u64_be(resp, offset, G_profile.phases[i].ticks);
+        write_u32_be(resp, offset + 8, G_profile.phases[i].calls);
+        offset += 12;
+    }
+
+    resp[offset++] = PROFILE_COUNTERS_COUNT;
+    for (size_t i = 0; i < PROFILE_COUNTERS_COUNT; i++) {
+        write_u32_be(resp, offset, G_profile.counters[i]);
+        offset += 4;
+    }
+
+    if (reset) {
+        profile_reset();
+    }
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+}
+
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+
+#ifdef HAVE_PROFILE
+
+#include <stdbool.h>  // bool
+
+/**
+ * Handler for GET_PROFILE command. Send the ticks and calls of each phase and the
+ * counters accumulated since the app started or the profile was last reset.
+ *
+ * @param[in] reset
+ *   Whether to reset the profile once sent.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_get_profile(bool reset);
+
+#endif
@@ -28,21 +28,60 @@
 #include "../io.h"
 #include "../sw.h"
 #include "../crypto.h"
+#include "../address.h"
+#include "../apdu/params.h"
 #include "../common/buffer.h"
 #include "../common/bip32_check.h"
 #include "../ui/display.h"
 #include "../helper/send_response.h"
 
-int handler_get_public_key(uint8_t flags, buffer_t *cdata, bool display) {
+/**
+ * Send the public key followed by the address hashes of all wallet versions. Versions use
+ * their default subwallet id unless one was given.
+ */
+static int send_address_hashes(bool has_subwallet_id) {
+    uint8_t resp[PUBKEY_LEN + 1 + WALLET_VERSIONS_COUNT * HASH_LEN] = {0};
+    size_t offset = 0;
+
+    memmove(resp + offset, G_context.pk_info.raw_public_key, PUBKEY_LEN);
+    offset += PUBKEY_LEN;
+
+    resp[offset++] = WALLET_VERSIONS_COUNT;
+    for (uint8_t version = 0; version < WALLET_VERSIONS_COUNT; version++) {
+        uint32_t subwallet_id = has_subwallet_id
+                                    ? G_context.pk_info.subwallet_id
+                                    : wallet_default_subwallet_id((wallet_version_e) version);
+        if (!wallet_to_hash((wallet_version_e) version,
+                            subwallet_id,
+                            G_context.pk_info.raw_public_key,
+                            resp + offset)) {
+            return io_send_sw(SW_BAD_STATE);
+        }
+        offset += HASH_LEN;
+    }
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+}
+
+int handler_get_public_key(uint8_t mode, uint8_t flags, buffer_t *cdata) {
     explicit_bzero(&G_context, sizeof(G_context));
     G_context.req_type = CONFIRM_ADDRESS;
     G_context.state = STATE_NONE;
+    G_context.pk_info.wallet_version = WALLET_V4R2;
+    G_context.pk_info.subwallet_id = DEFAULT_SUBWALLET_ID;
 
     if (!buffer_read_u8(cdata, &G_context.bip32_path_len) ||
         !buffer_read_bip32_path(cdata, G_context.bip32_path, (size_t) G_context.bip32_path_len)) {
         return io_send_sw(SW_WRONG_DATA_LENGTH);
     }
 
+    if ((flags & P2_ADDR_FLAG_WALLET_SPECIFIERS) &&
+        (!buffer_read_u32(cdata, &G_context.pk_info.subwallet_id, BE) ||
+         !buffer_read_u8(cdata, &G_context.pk_info.wallet_version) ||
+         G_context.pk_info.wallet_version >= WALLET_VERSIONS_COUNT)) {
+        return io_send_sw(SW_WRONG_DATA_LENGTH);
+    }
+
     if (!check_global_bip32_path()) {
         return io_send_sw(SW_BAD_BIP32_PATH);
     }
@@ -53,9 +92,13 @@ int handler_get_public_key(uint8_t flags, buffer_t *cdata, bool display) {
         return io_send_sw(SW_BAD_STATE);
     }
 
-    if (display) {
+    if (mode == P1_CONFIRM) {
         return ui_display_address(flags);
     }
 
+    if (mode == P1_ADDRESS_HASHES) {
+        return send_address_hashes(flags & P2_ADDR_FLAG_WALLET_SPECIFIERS);
+    }
+
     return helper_send_response_pubkey();
 }
@@ -11,14 +11,17 @@
  *
  * @see G_context.bip32_path, G_context.pk_info.raw_public_key
  *
+ * @param[in]     mode
+ *   P1_NON_CONFIRM to send the public key, P1_CONFIRM to display the address on screen
+ *   or P1_ADDRESS_HASHES to send the public key and the address hashes of all wallet
+ *   versions.
  * @param[in]     flags
- *   Address display flags
+ *   Address display flags, and whether a subwallet id and a wallet version follow the
+ *   BIP32 path.
  * @param[in,out] cdata
  *   Command data with BIP32 path.
- * @param[in]     display
- *   Whether to display address on screen or not.
  *
  * @return zero or positive integer if success, negative integer otherwise.
  *
  */
-int handler_get_public_key(uint8_t flags, buffer_t *cdata, bool display);
+int handler_get_public_key(uint8_t mode, uint8_t flags, buffer_t *cdata);
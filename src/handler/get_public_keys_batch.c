@@ -0,0 +1,71 @@
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // memmove, explicit_bzero
+
+#include "os.h"
+
+#include "get_public_keys_batch.h"
+#include "../globals.h"
+#include "../types.h"
+#include "../io.h"
+#include "../sw.h"
+#include "../crypto.h"
+#include "../address.h"
+#include "../common/buffer.h"
+#include "../common/bip32.h"
+#include "../common/bip32_check.h"
+
+#define HARDENED_BIT 0x80000000
+
+int handler_get_public_keys_batch(bool address_hashes, buffer_t *cdata) {
+    uint8_t resp[1 + MAX_KEYS_PER_BATCH * PUBKEY_LEN] = {0};
+    size_t offset = 1;
+    uint8_t base_len = 0;
+    uint32_t start = 0;
+    uint8_t count = 0;
+
+    explicit_bzero(&G_context, sizeof(G_context));
+    G_context.req_type = CONFIRM_ADDRESS;
+    G_context.state = STATE_NONE;
+
+    if (!buffer_read_u8(cdata, &base_len) || base_len >= MAX_BIP32_PATH ||
+        !buffer_read_bip32_path(cdata, G_context.bip32_path, (size_t) base_len) ||
+        !buffer_read_u32(cdata, &start, BE) || !buffer_read_u8(cdata, &count) || count == 0) {
+        return io_send_sw(SW_WRONG_DATA_LENGTH);
+    }
+
+    // Indexes of a batch must all be hardened or all be non hardened
+    G_context.bip32_path_len = base_len + 1;
+    if (!check_global_bip32_path() ||
+        (start & ~HARDENED_BIT) > (~HARDENED_BIT) - (uint32_t) (count - 1)) {
+        return io_send_sw(SW_BAD_BIP32_PATH);
+    }
+
+    if (count > MAX_KEYS_PER_BATCH) {
+        count = MAX_KEYS_PER_BATCH;
+    }
+
+    resp[0] = count;
+    for (uint8_t i = 0; i < count; i++) {
+        G_context.bip32_path[base_len] = start + i;
+        if (crypto_derive_public_key(G_context.bip32_path,
+                                     G_context.bip32_path_len,
+                                     G_context.pk_info.raw_public_key) < 0) {
+            explicit_bzero(&G_context, sizeof(G_context));
+            return io_send_sw(SW_BAD_STATE);
+        }
+
+        if (address_hashes) {
+            if (!pubkey_to_hash(G_context.pk_info.raw_public_key, resp + offset, HASH_LEN)) {
+                explicit_bzero(&G_context, sizeof(G_context));
+                return io_send_sw(SW_BAD_STATE);
+            }
+        } else {
+            memmove(resp + offset, G_context.pk_info.raw_public_key, PUBKEY_LEN);
+        }
+        offset += PUBKEY_LEN;
+    }
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "../constants.h"
+#include "../common/buffer.h"
+
+/**
+ * Max number of public keys or address hashes returned in one response.
+ */
+#define MAX_KEYS_PER_BATCH 7
+
+/**
+ * Handler for GET_PUBLIC_KEYS_BATCH command. Derive public keys of consecutive
+ * indexes appended to a base BIP32 path and send as many of them as fit in one
+ * APDU response, the client asks for the rest from the first index not returned.
+ *
+ * @param[in]     address_hashes
+ *   Whether to send hashes of wallet v4 addresses instead of public keys.
+ * @param[in,out] cdata
+ *   Command data with base BIP32 path, first index and number of keys.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_get_public_keys_batch(bool address_hashes, buffer_t *cdata);
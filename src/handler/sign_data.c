@@ -30,6 +30,9 @@
 #include "../ui/display.h"
 #include "../common/buffer.h"
 #include "../common/bip32_check.h"
+#include "../common/crc16.h"
+#include "../common/profile.h"
+#include "../helper/send_response.h"
 #include "../sign_data/sign_data_deserialize.h"
 
 int handler_sign_data(buffer_t *cdata, bool first, bool more) {
@@ -53,7 +56,8 @@ int handler_sign_data(buffer_t *cdata, bool first, bool more) {
         return io_send_sw(SW_OK);
     }
 
-    if (G_context.req_type != CONFIRM_SIGN_DATA) {
+    // No chunk may follow the last one, the review may be displayed
+    if (G_context.req_type != CONFIRM_SIGN_DATA || G_context.state != STATE_NONE) {
         return io_send_sw(SW_BAD_STATE);
     }
 
@@ -67,19 +71,34 @@ int handler_sign_data(buffer_t *cdata, bool first, bool more) {
         return io_send_sw(SW_WRONG_SIGN_DATA_LENGTH);
     }
 
+    // Chunks are checked as they are received
+    size_t chunk_offset = G_context.sign_data_info.raw_data_len;
     G_context.sign_data_info.raw_data_len += cdata->size;
+    if (!sign_data_check_chunk(G_context.sign_data_info.raw_data,
+                               G_context.sign_data_info.raw_data_len,
+                               chunk_offset)) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_SIGN_DATA_PARSING_FAIL);
+    }
+    G_context.sign_data_info.chunks_crc =
+        crc16_continue(G_context.sign_data_info.chunks_crc,
+                       &G_context.sign_data_info.raw_data[chunk_offset],
+                       cdata->size);
 
     if (more) {
-        return io_send_sw(SW_OK);
+        return helper_send_response_chunk_crc(G_context.sign_data_info.chunks_crc);
     }
 
     buffer_t buf = {.ptr = G_context.sign_data_info.raw_data,
                     .size = G_context.sign_data_info.raw_data_len,
                     .offset = 0};
 
-    // Parse
+    // Parse and hash
+    PROFILE_BEGIN(PROFILE_DESERIALIZE);
     bool ok = sign_data_deserialize(&buf, &G_context.sign_data_info);
+    PROFILE_END(PROFILE_DESERIALIZE);
     if (!ok) {
+        explicit_bzero(&G_context, sizeof(G_context));
         return io_send_sw(SW_SIGN_DATA_PARSING_FAIL);
     }
 
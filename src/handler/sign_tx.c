@@ -30,9 +30,11 @@
 #include "../ui/display.h"
 #include "../common/buffer.h"
 #include "../common/bip32_check.h"
+#include "../common/crc16.h"
+#include "../helper/send_response.h"
 #include "../transaction/types.h"
 #include "../transaction/deserialize.h"
-#include "../transaction/hash.h"
+#include "../transaction/request.h"
 
 int handler_sign_tx(buffer_t *cdata, bool first, bool more) {
     if (first) {  // first APDU, parse BIP32 path
@@ -51,46 +53,41 @@ int handler_sign_tx(buffer_t *cdata, bool first, bool more) {
 
         G_context.req_type = CONFIRM_TRANSACTION;
         G_context.state = STATE_NONE;
+        transaction_deserialize_init(&G_context.tx_info.transaction);
 
-        return io_send_sw(SW_OK);
-    }
-
-    if (G_context.req_type != CONFIRM_TRANSACTION) {
+        // Unless the whole transaction follows the path
+        if (more) {
+            return io_send_sw(SW_OK);
+        }
+    } else if (G_context.req_type != CONFIRM_TRANSACTION || G_context.state != STATE_NONE) {
+        // No chunk may follow the last one, the review may be displayed
         return io_send_sw(SW_BAD_STATE);
     }
 
-    if (G_context.tx_info.raw_tx_len + cdata->size > MAX_TRANSACTION_LEN) {
-        return io_send_sw(SW_WRONG_TX_LENGTH);
-    }
-
-    if (!buffer_move(cdata, &G_context.tx_info.raw_tx[G_context.tx_info.raw_tx_len], cdata->size)) {
-        return io_send_sw(SW_WRONG_TX_LENGTH);
-    }
-
-    G_context.tx_info.raw_tx_len += cdata->size;
-
-    if (more) {
-        return io_send_sw(SW_OK);
-    }
-
-    buffer_t buf = {.ptr = G_context.tx_info.raw_tx,
-                    .size = G_context.tx_info.raw_tx_len,
-                    .offset = 0};
-
-    // Parse
-    parser_status_e status = transaction_deserialize(&buf, &G_context.tx_info.transaction);
+    // Requests are parsed and hashed as chunks are received
+    transaction_t *tx = &G_context.tx_info.transaction;
+    G_context.tx_info.chunks_crc = crc16_continue(G_context.tx_info.chunks_crc,
+                                                  cdata->ptr + cdata->offset,
+                                                  cdata->size - cdata->offset);
+    parser_status_e status = request_deserialize_chunk(cdata, tx, !more);
     PRINTF("Parsing status: %d.\n", status);
     if (status != PARSING_OK) {
+        explicit_bzero(&G_context, sizeof(G_context));
         return io_send_sw(SW_TX_PARSING_FAIL);
     }
 
-    if (G_context.tx_info.transaction.is_blind && !N_storage.blind_signing_enabled) {
+    if (more) {
+        return helper_send_response_chunk_crc(G_context.tx_info.chunks_crc);
+    }
+
+    if (tx->is_blind && !N_storage.blind_signing_enabled) {
+        explicit_bzero(&G_context, sizeof(G_context));
         ui_blind_signing_error();
         return io_send_sw(SW_BLIND_SIGNING_DISABLED);
     }
 
-    // Hash
-    if (!hash_tx(&G_context.tx_info)) {
+    if (!request_hash(&G_context.tx_info)) {
+        explicit_bzero(&G_context, sizeof(G_context));
         return io_send_sw(SW_TX_PARSING_FAIL);
     }
 
@@ -11,7 +11,8 @@
  * @param[in,out] cdata
  *   Command data with BIP32 path and raw transaction serialized.
  * @param[in]     first
- *   Whether this is the first chunk or not
+ *   Whether this is the first chunk, with the BIP32 path and, if there are no more
+ *   chunks, the whole transaction.
  * @param[in]     more
  *   Whether more APDU chunks are to be received or not.
  *
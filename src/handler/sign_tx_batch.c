@@ -0,0 +1,120 @@
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stddef.h>   // size_t
+#include <string.h>   // explicit_bzero
+
+#include "os.h"
+
+#include "sign_tx_batch.h"
+#include "../sw.h"
+#include "../globals.h"
+#include "../crypto.h"
+#include "../ui/display.h"
+#include "../common/buffer.h"
+#include "../common/bip32_check.h"
+#include "../common/crc16.h"
+#include "../helper/send_response.h"
+#include "../transaction/types.h"
+#include "../transaction/deserialize.h"
+#include "../transaction/request.h"
+
+int handler_sign_tx_batch_review(uint8_t flags, buffer_t *cdata) {
+    batch_ctx_t *batch = &G_context.batch_info;
+
+    explicit_bzero(&G_context, sizeof(G_context));
+    G_context.req_type = CONFIRM_BATCH;
+    G_context.state = STATE_NONE;
+
+    if (!buffer_read_u8(cdata, &G_context.bip32_path_len) ||
+        !buffer_read_bip32_path(cdata, G_context.bip32_path, (size_t) G_context.bip32_path_len) ||
+        !buffer_read_u8(cdata, &batch->count) || batch->count == 0 ||
+        !buffer_read_u64(cdata, &batch->max_amount, BE)) {
+        return io_send_sw(SW_WRONG_DATA_LENGTH);
+    }
+
+    if (!check_global_bip32_path()) {
+        return io_send_sw(SW_BAD_BIP32_PATH);
+    }
+
+    // Transactions of a batch are signed without being displayed
+    if (!N_storage.blind_signing_enabled) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        ui_blind_signing_error();
+        return io_send_sw(SW_BLIND_SIGNING_DISABLED);
+    }
+
+    // The key is derived once and kept until all transactions are signed
+    if (crypto_derive_key_pair(G_context.bip32_path,
+                               G_context.bip32_path_len,
+                               &batch->private_key,
+                               batch->raw_public_key) < 0) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    G_context.state = STATE_PARSED;
+
+    int ret = ui_display_batch(flags);
+    if (ret < 0) {
+        explicit_bzero(&G_context, sizeof(G_context));
+    }
+
+    return ret;
+}
+
+int handler_sign_tx_batch_transaction(buffer_t *cdata, bool first, bool more) {
+    batch_ctx_t *batch = &G_context.batch_info;
+
+    if (G_context.req_type != CONFIRM_BATCH || G_context.state != STATE_APPROVED) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (first) {
+        explicit_bzero(&batch->order, sizeof(batch->order));
+        transaction_deserialize_init(&batch->order.transaction);
+        batch->order_started = true;
+    } else if (!batch->order_started) {
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    batch->order.chunks_crc = crc16_continue(batch->order.chunks_crc,
+                                             cdata->ptr + cdata->offset,
+                                             cdata->size - cdata->offset);
+
+    // A transaction which can not be parsed ends the batch
+    parser_status_e status = request_deserialize_chunk(cdata, &batch->order.transaction, !more);
+    PRINTF("Parsing status: %d.\n", status);
+    if (status != PARSING_OK || (!more && !request_hash(&batch->order))) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_TX_PARSING_FAIL);
+    }
+
+    if (more) {
+        return helper_send_response_chunk_crc(batch->order.chunks_crc);
+    }
+
+    // Transactions may not send more than the amount approved for the whole batch
+    uint64_t amount;
+    if (!request_sent_amount(&batch->order.transaction, &amount) ||
+        amount > batch->max_amount - batch->sent_amount) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_BATCH_AMOUNT_EXCEEDED);
+    }
+
+    if (crypto_sign_batch_order() < 0) {
+        explicit_bzero(&G_context, sizeof(G_context));
+        return io_send_sw(SW_SIGNATURE_FAIL);
+    }
+    batch->order_started = false;
+    batch->signed_count++;
+    batch->sent_amount += amount;
+
+    int ret = helper_send_response_sig_batch();
+
+    // The key is wiped once the number of transactions approved is reached
+    if (batch->signed_count == batch->count) {
+        explicit_bzero(&G_context, sizeof(G_context));
+    }
+
+    return ret;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "../common/buffer.h"
+
+/**
+ * Handler for the review of a SIGN_TX_BATCH command. If successfully parse BIP32 path,
+ * number of transactions and max amount, derive the key of the batch and ask confirmation.
+ *
+ * @param[in]     flags
+ *   Address display flags
+ * @param[in,out] cdata
+ *   Command data with BIP32 path, number of transactions and max amount.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_sign_tx_batch_review(uint8_t flags, buffer_t *cdata);
+
+/**
+ * Handler for a transaction of an approved SIGN_TX_BATCH command. If successfully parse
+ * transaction and it fits in the amount left, sign it with the key of the batch and send
+ * APDU response.
+ *
+ * @param[in,out] cdata
+ *   Command data with raw transaction serialized.
+ * @param[in]     first
+ *   Whether this is the first chunk of the transaction or not.
+ * @param[in]     more
+ *   Whether more APDU chunks are to be received or not.
+ *
+ * @return zero or positive integer if success, negative integer otherwise.
+ *
+ */
+int handler_sign_tx_batch_transaction(buffer_t *cdata, bool first, bool more);
@@ -85,3 +85,27 @@ int helper_send_response_sig_sign_data() {
 
     return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
 }
+
+int helper_send_response_sig_batch() {
+    uint8_t resp[1 + SIG_LEN + 1 + HASH_LEN] = {0};
+    size_t offset = 0;
+
+    // Signature
+    resp[offset++] = SIG_LEN;
+    memmove(resp + offset, G_context.batch_info.order.signature, SIG_LEN);
+    offset += SIG_LEN;
+
+    // Hash
+    resp[offset++] = HASH_LEN;
+    memmove(resp + offset, G_context.batch_info.order.m_hash, HASH_LEN);
+    offset += HASH_LEN;
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = offset, .offset = 0}, SW_OK);
+}
+
+int helper_send_response_chunk_crc(uint16_t crc) {
+    uint8_t resp[2] = {(uint8_t) (crc >> 8), (uint8_t) crc};
+
+    return io_send_response(&(const buffer_t){.ptr = resp, .size = sizeof(resp), .offset = 0},
+                            SW_OK);
+}
@@ -50,3 +50,29 @@ int helper_send_response_sig_proof(void);
  *
  */
 int helper_send_response_sig_sign_data(void);
+
+/**
+ * Helper to send APDU response with signature of a transaction of a batch
+ *
+ * response = SIG_LEN (1) ||
+ *            G_context.batch_info.order.signature (SIG_LEN) ||
+ *            HASH_LEN (1) ||
+ *            G_context.batch_info.order.m_hash (HASH_LEN)
+ *
+ * @return zero or positive integer if success, -1 otherwise.
+ *
+ */
+int helper_send_response_sig_batch(void);
+
+/**
+ * Helper to send APDU response acknowledging a chunk of a request
+ *
+ * response = crc (2)
+ *
+ * @param[in] crc
+ *   CRC-CCITT of the chunks received so far.
+ *
+ * @return zero or positive integer if success, -1 otherwise.
+ *
+ */
+int helper_send_response_chunk_crc(uint16_t crc);
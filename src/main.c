@@ -29,6 +29,8 @@
 #include "ui/menu.h"
 #include "apdu/parser.h"
 #include "apdu/dispatcher.h"
+#include "common/pubkey_cache.h"
+#include "common/profile.h"
 
 uint8_t G_io_seproxyhal_spi_buffer[IO_SEPROXYHAL_BUFFER_SIZE_B];
 io_state_e G_io_state;
@@ -76,7 +78,10 @@ void app_main() {
                 }
 
                 // Parse APDU command from G_io_apdu_buffer
-                if (!apdu_parser(&cmd, G_io_apdu_buffer, input_len)) {
+                PROFILE_BEGIN(PROFILE_APDU);
+                bool parsed = apdu_parser(&cmd, G_io_apdu_buffer, input_len);
+                PROFILE_END(PROFILE_APDU);
+                if (!parsed) {
                     PRINTF("=> /!\\ BAD LENGTH: %.*H\n", input_len, G_io_apdu_buffer);
                     io_send_sw(SW_WRONG_DATA_LENGTH);
                     continue;
@@ -115,6 +120,7 @@ void app_main() {
 void app_exit() {
     BEGIN_TRY_L(exit) {
         TRY_L(exit) {
+            pubkey_cache_clear();
             os_sched_exit(-1);
         }
         FINALLY_L(exit) {
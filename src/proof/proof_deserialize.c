@@ -2,12 +2,11 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include "cx.h"
-
 #include "proof_deserialize.h"
 
 #include "../common/buffer.h"
 #include "../common/bip32_check.h"
+#include "../common/hasher.h"
 #include "../types.h"
 #include "../globals.h"
 #include "../io.h"
@@ -20,7 +19,7 @@ static const uint8_t TON_PROOF_ITEM_STR[] = "ton-proof-item-v2/";
 static const uint8_t TON_CONNECT_STR[] = "\xff\xffton-connect";
 
 #define SAFE(RES)                 \
-    if ((RES) != CX_OK) {         \
+    if (!(RES)) {                 \
         io_send_sw(SW_BAD_STATE); \
         return false;             \
     }
@@ -37,9 +36,11 @@ bool deserialize_proof(buffer_t *cdata, uint8_t flags) {
         return false;
     }
 
-    if (crypto_derive_public_key(G_context.bip32_path,
-                                 G_context.bip32_path_len,
-                                 G_context.proof_info.raw_public_key) < 0) {
+    // The private key is kept for signing once the proof is approved
+    if (crypto_derive_key_pair(G_context.bip32_path,
+                               G_context.bip32_path_len,
+                               &G_context.proof_info.private_key,
+                               G_context.proof_info.raw_public_key) < 0) {
         io_send_sw(SW_BAD_STATE);
         return false;
     }
@@ -89,69 +90,29 @@ bool deserialize_proof(buffer_t *cdata, uint8_t flags) {
         return false;
     }
 
-    cx_sha256_t state;
-    SAFE(cx_sha256_init_no_throw(&state));
+    hasher_t hasher;
+    SAFE(hasher_init(&hasher));
 
     // sizeof - 1 because const strings are null terminated
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          0,
-                          TON_PROOF_ITEM_STR,
-                          sizeof(TON_PROOF_ITEM_STR) - 1,
-                          NULL,
-                          0));
-
-    for (int i = 3; i >= 0; i--) {
-        uint8_t wc_part = (G_context.proof_info.workchain >> (i * 8)) & 0xff;
-        SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, &wc_part, 1, NULL, 0));
-    }
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          0,
-                          G_context.proof_info.address_hash,
-                          sizeof(G_context.proof_info.address_hash),
-                          NULL,
-                          0));
-
-    for (int i = 0; i < 4; i++) {
-        uint8_t domain_len_part = (G_context.proof_info.domain_len >> (i * 8)) & 0xff;
-        SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, &domain_len_part, 1, NULL, 0));
-    }
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          0,
-                          G_context.proof_info.domain,
-                          G_context.proof_info.domain_len,
-                          NULL,
-                          0));
-
-    for (int i = 0; i < 8; i++) {
-        uint8_t ts_part = (timestamp >> (i * 8)) & 0xff;
-        SAFE(cx_hash_no_throw((cx_hash_t *) &state, 0, &ts_part, 1, NULL, 0));
-    }
+    SAFE(hasher_update(&hasher, TON_PROOF_ITEM_STR, sizeof(TON_PROOF_ITEM_STR) - 1));
+    SAFE(hasher_update_be(&hasher, (uint32_t) G_context.proof_info.workchain, 4));
+    SAFE(hasher_update(&hasher,
+                       G_context.proof_info.address_hash,
+                       sizeof(G_context.proof_info.address_hash)));
+    SAFE(hasher_update_le(&hasher, G_context.proof_info.domain_len, 4));
+    SAFE(hasher_update(&hasher, G_context.proof_info.domain, G_context.proof_info.domain_len));
+    SAFE(hasher_update_le(&hasher, timestamp, 8));
+    SAFE(hasher_update(&hasher, payload, payload_len));
 
     uint8_t inner[HASH_LEN];
+    SAFE(hasher_final(&hasher, inner));
 
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          CX_LAST,
-                          payload,
-                          payload_len,
-                          inner,
-                          sizeof(inner)));
-
-    SAFE(cx_sha256_init_no_throw(&state));
+    SAFE(hasher_init(&hasher));
 
     // sizeof - 1 because const strings are null terminated
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          0,
-                          TON_CONNECT_STR,
-                          sizeof(TON_CONNECT_STR) - 1,
-                          NULL,
-                          0));
-
-    SAFE(cx_hash_no_throw((cx_hash_t *) &state,
-                          CX_LAST,
-                          inner,
-                          sizeof(inner),
-                          G_context.proof_info.hash,
-                          sizeof(G_context.proof_info.hash)));
+    SAFE(hasher_update(&hasher, TON_CONNECT_STR, sizeof(TON_CONNECT_STR) - 1));
+    SAFE(hasher_update(&hasher, inner, sizeof(inner)));
+    SAFE(hasher_final(&hasher, G_context.proof_info.hash));
 
     return true;
 }
@@ -13,7 +13,7 @@
 
 #define PLAINTEXT_REQUEST          0x754bf91b
 #define APP_DATA_REQUEST           0x54b58535
-#define MAX_PLAINTEXT_LENGTH       120
+#define MAX_PLAINTEXT_LENGTH       250  // fits in the body of a hint
 #define MAX_APP_DATA_DOMAIN_LENGTH 126  // max allowed domain len as per TON DNS spec
 
 #define SAFE(RES)     \
@@ -42,27 +42,29 @@ void encode_domain(BitString_t* self, uint8_t* domain, size_t domain_len) {
     BitString_storeUint(self, 0, 8);
 }
 
-void encode_text(BitString_t* self,
-                 uint8_t* data,
-                 size_t data_len,
-                 CellRef_t* out_ref,
-                 bool* out_has_ref) {
-    uint8_t storeMax = (1023 - self->data_cursor) / 8;
-    if (data_len > storeMax) {
-        BitString_t inner;
-        CellRef_t innerRef;
-        bool innerHasRef;
-        CellRef_t selfRef;
-        BitString_init(&inner);
-        encode_text(&inner, &data[storeMax], data_len - storeMax, &innerRef, &innerHasRef);
-        hash_Cell(&inner, &innerRef, innerHasRef ? 1 : 0, &selfRef);
-        BitString_storeBuffer(self, data, storeMax);
-        *out_ref = selfRef;
-        *out_has_ref = true;
-    } else {
-        BitString_storeBuffer(self, data, data_len);
-        *out_has_ref = false;
+bool sign_data_check_chunk(const uint8_t* data, size_t data_len, size_t chunk_offset) {
+    // Schema and timestamp
+    const size_t header_len = 4 + 8;
+
+    if (data_len < 4) {
+        return true;
+    }
+
+    uint32_t schema_crc = ((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) |
+                          ((uint32_t) data[2] << 8) | data[3];
+    if (schema_crc == APP_DATA_REQUEST) {
+        return true;
+    }
+    if (schema_crc != PLAINTEXT_REQUEST || data_len > header_len + MAX_PLAINTEXT_LENGTH) {
+        return false;
     }
+
+    size_t start = chunk_offset > header_len ? chunk_offset : header_len;
+    if (data_len > start) {
+        SAFE(check_ascii(data + start, data_len - start));
+    }
+
+    return true;
 }
 
 bool sign_data_deserialize(buffer_t* buf, sign_data_ctx_t* ctx) {
@@ -83,9 +85,9 @@ bool sign_data_deserialize(buffer_t* buf, sign_data_ctx_t* ctx) {
             uint8_t* data;
             SAFE(buffer_read_ref(buf, &data, len));
             SAFE(check_ascii(data, len));
-            add_hint_text(&ctx->hints, "Text", (char*) data, len);
+            SAFE(add_hint_text(&ctx->hints, "Text", (char*) data, len));
             bool has_ref;
-            encode_text(&bits, data, len, &refs[cur_ref], &has_ref);
+            SAFE(hash_SnakeData(&bits, data, len, &refs[cur_ref], &has_ref));
             if (has_ref) {
                 cur_ref++;
             }
@@ -97,7 +99,7 @@ bool sign_data_deserialize(buffer_t* buf, sign_data_ctx_t* ctx) {
             if (has_address) {
                 address_t addr;
                 SAFE(buffer_read_address(buf, &addr));
-                add_hint_address(&ctx->hints, "Contract address", addr, true);
+                SAFE(add_hint_address(&ctx->hints, "Contract address", addr, true));
                 BitString_storeBit(&bits, 1);
                 BitString_storeAddress(&bits, addr.chain, addr.hash);
             } else {
@@ -124,20 +126,20 @@ bool sign_data_deserialize(buffer_t* buf, sign_data_ctx_t* ctx) {
                 hash_Cell(&inner, NULL, 0, &refs[cur_ref]);
                 cur_ref++;
                 BitString_storeBit(&bits, 1);
-                add_hint_text(&ctx->hints, "App domain", (char*) domain, domain_len);
+                SAFE(add_hint_text(&ctx->hints, "App domain", (char*) domain, domain_len));
             } else {
                 BitString_storeBit(&bits, 0);
             }
 
             SAFE(buffer_read_cell_ref(buf, &refs[cur_ref]));
-            add_hint_hash(&ctx->hints, "Data hash", refs[cur_ref].hash);
+            SAFE(add_hint_hash(&ctx->hints, "Data hash", refs[cur_ref].hash));
             cur_ref++;
 
             bool has_ext;
             SAFE(buffer_read_bool(buf, &has_ext));
             if (has_ext) {
                 SAFE(buffer_read_cell_ref(buf, &refs[cur_ref]));
-                add_hint_hash(&ctx->hints, "Extension hash", refs[cur_ref].hash);
+                SAFE(add_hint_hash(&ctx->hints, "Extension hash", refs[cur_ref].hash));
                 cur_ref++;
                 BitString_storeBit(&bits, 1);
             } else {
@@ -1,8 +1,26 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "../common/buffer.h"
 #include "../types.h"
 
 bool sign_data_deserialize(buffer_t *buf, sign_data_ctx_t *ctx);
+
+/**
+ * Check the data received so far as soon as a chunk is received: the schema must be known
+ * and plaintext must be short enough and ASCII.
+ *
+ * @param[in] data
+ *   Pointer to the data received so far.
+ * @param[in] data_len
+ *   Length of the data received so far.
+ * @param[in] chunk_offset
+ *   Offset of the last chunk in data, bytes before it have already been checked.
+ *
+ * @return true if the data may be valid once complete, false otherwise.
+ *
+ */
+bool sign_data_check_chunk(const uint8_t *data, size_t data_len, size_t chunk_offset);
@@ -52,6 +52,10 @@
  * Status word for failure of custom data parsing.
  */
 #define SW_SIGN_DATA_PARSING_FAIL 0xB011
+/**
+ * Status word for hints which can not be displayed whole.
+ */
+#define SW_DISPLAY_HINTS_FAIL 0xB006
 /**
  * Status word for bad state.
  */
@@ -64,6 +68,10 @@
  * Status word for a request that is too long.
  */
 #define SW_REQUEST_TOO_LONG 0xB00B
+/**
+ * Status word for a transaction sending more than the amount left in its batch.
+ */
+#define SW_BATCH_AMOUNT_EXCEEDED 0xB00C
 /**
  * Status word for bad bip32 path.
  */
@@ -15,79 +15,379 @@
  *  limitations under the License.
  *****************************************************************************/
 
+#include <stdio.h>   // snprintf
+#include <string.h>  // memmove, strlen
+
+#include "os.h"
+
 #include "deserialize.h"
 #include "types.h"
 #include "../common/buffer.h"
 #include "hash.h"
 #include "../common/cell.h"
+#include "../common/boc.h"
+#include "../common/profile.h"
 #include "transaction_hints.h"
 #include "../constants.h"
 #include "../common/types.h"
 
 #define SAFE(RES, CODE) \
-    if (!RES) {         \
+    if (!(RES)) {       \
         return CODE;    \
     }
 
-parser_status_e transaction_deserialize(buffer_t *buf, transaction_t *tx) {
-    if (buf->size > MAX_TRANSACTION_LEN) {
-        return WRONG_LENGTH_ERROR;
+/**
+ * Hints added in front of the hints of each message of orders with several messages:
+ * operation, amount, receiver and blind payload.
+ */
+#define MESSAGE_HEADER_HINTS 4
+
+static const char *const message_titles[MAX_MESSAGES] = {"Message 1",
+                                                        "Message 2",
+                                                        "Message 3",
+                                                        "Message 4"};
+
+/**
+ * Add hints with the fields of a message which are otherwise displayed for the whole
+ * transaction, in front of the message hints.
+ */
+static parser_status_e add_message_hints(transaction_t *tx,
+                                         message_t *msg,
+                                         uint8_t index,
+                                         uint8_t start) {
+    uint8_t count = tx->hints.hints_count;
+
+    SAFE(add_hint_text(&tx->hints,
+                       (const char *) PIC(message_titles[index]),
+                       msg->title,
+                       strlen(msg->title)),
+         HINTS_PARSING_ERROR);
+    if ((msg->send_mode & 128) != 0) {
+        SAFE(add_hint_text(&tx->hints, "Amount", "ALL YOUR TONs", 13), HINTS_PARSING_ERROR);
+    } else {
+        SAFE(add_hint_amount(&tx->hints,
+                             "Amount",
+                             "TON",
+                             msg->value_buf,
+                             msg->value_len,
+                             EXPONENT_SMALLEST_UNIT),
+             HINTS_PARSING_ERROR);
+    }
+    SAFE(add_hint_address(&tx->hints, msg->recipient, msg->to, msg->bounce),
+         HINTS_PARSING_ERROR);
+    if (msg->has_payload && msg->is_blind) {
+        SAFE(add_hint_hash(&tx->hints, "Payload", msg->payload.hash), HINTS_PARSING_ERROR);
+    }
+
+    move_hints_before(&tx->hints, start, tx->hints.hints_count - count);
+
+    return PARSING_OK;
+}
+
+static void expect_field(tx_parser_t *p, tx_state_e state, uint8_t len) {
+    p->state = state;
+    p->field_len = len;
+    p->scratch_len = 0;
+}
+
+/**
+ * Accumulate bytes of the fixed size field being read.
+ *
+ * @return true once the field is complete.
+ */
+static bool fill_field(tx_parser_t *p, buffer_t *buf) {
+    size_t len = p->field_len - p->scratch_len;
+    if (len > buf->size - buf->offset) {
+        len = buf->size - buf->offset;
+    }
+    buffer_read_buffer(buf, p->scratch + p->scratch_len, len);
+    p->scratch_len += len;
+
+    return p->scratch_len == p->field_len;
+}
+
+static parser_status_e consume_message_field(transaction_t *tx, message_t *msg, buffer_t *field) {
+    tx_parser_t *p = &tx->parser;
+
+    switch (p->state) {
+        case TX_STATE_VALUE_LEN:
+            SAFE(buffer_read_u8(field, &msg->value_len), VALUE_PARSING_ERROR);
+            SAFE(msg->value_len <= MAX_VALUE_BYTES_LEN, VALUE_PARSING_ERROR);
+            expect_field(p, TX_STATE_MESSAGE, msg->value_len + 1 + HASH_LEN + 3);
+            return PARSING_OK;
+        case TX_STATE_MESSAGE:
+            SAFE(buffer_read_buffer(field, msg->value_buf, msg->value_len), VALUE_PARSING_ERROR);
+            SAFE(buffer_read_address(field, &msg->to), TO_PARSING_ERROR);
+            SAFE(buffer_read_bool(field, &msg->bounce), BOUNCE_PARSING_ERROR);
+            SAFE(buffer_read_u8(field, &msg->send_mode), SEND_MODE_PARSING_ERROR);
+
+            // state-init
+            SAFE(buffer_read_bool(field, &msg->has_state_init), STATE_INIT_PARSING_ERROR);
+            if (msg->has_state_init) {
+                expect_field(p, TX_STATE_STATE_INIT, 2 + HASH_LEN);
+            } else {
+                expect_field(p, TX_STATE_PAYLOAD_TYPE, 1);
+            }
+            return PARSING_OK;
+        case TX_STATE_STATE_INIT:
+            SAFE(buffer_read_cell_ref(field, &msg->state_init), STATE_INIT_PARSING_ERROR);
+            expect_field(p, TX_STATE_PAYLOAD_TYPE, 1);
+            return PARSING_OK;
+        case TX_STATE_PAYLOAD_TYPE: {
+            uint8_t payload_type;
+            SAFE(buffer_read_u8(field, &payload_type), PAYLOAD_PARSING_ERROR);
+            msg->has_payload = payload_type != PAYLOAD_NONE;
+            msg->payload_is_boc = payload_type == PAYLOAD_BOC;
+            if (payload_type == PAYLOAD_CELL_REF) {
+                expect_field(p, TX_STATE_PAYLOAD, 2 + HASH_LEN);
+            } else if (payload_type == PAYLOAD_BOC) {
+                // Cells are kept for the whole transaction, only one message may use them
+                for (const message_t *other = tx->messages; other < msg; other++) {
+                    SAFE(!other->payload_is_boc, PAYLOAD_PARSING_ERROR);
+                }
+                expect_field(p, TX_STATE_BOC_LEN, 2);
+            } else if (payload_type == PAYLOAD_NONE) {
+                expect_field(p, TX_STATE_HAS_HINTS, 1);
+            } else {
+                return PAYLOAD_PARSING_ERROR;
+            }
+            return PARSING_OK;
+        }
+        case TX_STATE_PAYLOAD:
+            SAFE(buffer_read_cell_ref(field, &msg->payload), STATE_INIT_PARSING_ERROR);
+            expect_field(p, TX_STATE_HAS_HINTS, 1);
+            return PARSING_OK;
+        case TX_STATE_BOC_LEN:
+            SAFE(buffer_read_u16(field, &p->remaining, BE), PAYLOAD_PARSING_ERROR);
+            SAFE(p->remaining > 0, PAYLOAD_PARSING_ERROR);
+            // Cell data is kept with hints data, hints of the payload may point into it
+            Boc_init(&tx->payload_boc,
+                     &tx->hints_data[tx->hints_data_len],
+                     MAX_HINTS_DATA_LEN - tx->hints_data_len);
+            p->state = TX_STATE_BOC;
+            return PARSING_OK;
+        case TX_STATE_HAS_HINTS:
+            SAFE(buffer_read_bool(field, &msg->has_hints), HINTS_PARSING_ERROR);
+            if (msg->has_hints) {
+                SAFE(msg->has_payload, HINTS_PARSING_ERROR);
+                expect_field(p, TX_STATE_HINTS_HEADER, 4 + 2);
+            } else {
+                p->state = TX_STATE_MESSAGE_DONE;
+            }
+            return PARSING_OK;
+        case TX_STATE_HINTS_HEADER:
+            SAFE(buffer_read_u32(field, &msg->hints_type, BE), HINTS_PARSING_ERROR);
+            SAFE(buffer_read_u16(field, &msg->hints_len, BE), HINTS_PARSING_ERROR);
+            SAFE(msg->hints_len <= MAX_HINTS_DATA_LEN - tx->hints_data_len, HINTS_PARSING_ERROR);
+            msg->hints_data = &tx->hints_data[tx->hints_data_len];
+            tx->hints_data_len += msg->hints_len;
+            p->remaining = msg->hints_len;
+            p->state = p->remaining > 0 ? TX_STATE_HINTS_DATA : TX_STATE_MESSAGE_DONE;
+            return PARSING_OK;
+        default:
+            return GENERAL_ERROR;
     }
+}
+
+void message_deserialize_init(transaction_t *tx) {
+    expect_field(&tx->parser, TX_STATE_VALUE_LEN, 1);
+}
+
+parser_status_e message_deserialize(buffer_t *buf, transaction_t *tx, message_t *msg) {
+    tx_parser_t *p = &tx->parser;
 
-    // tag
-    SAFE(buffer_read_u8(buf, &tx->tag), TAG_PARSING_ERROR);
-    if (tx->tag >= 0x02) {  // Only 0x00 and 0x01 are supported now
-        return TAG_PARSING_ERROR;
+    while (buf->offset < buf->size && p->state != TX_STATE_MESSAGE_DONE) {
+        size_t available = buf->size - buf->offset;
+        const uint8_t *data = buf->ptr + buf->offset;
+
+        if (p->state == TX_STATE_BOC) {
+            // Bag of cells is copied by its parser
+            size_t len = available < p->remaining ? available : p->remaining;
+            SAFE(Boc_feed(&tx->payload_boc, data, len), PAYLOAD_PARSING_ERROR);
+            buffer_seek_cur(buf, len);
+            p->remaining -= len;
+            if (p->remaining == 0) {
+                SAFE(Boc_finalize(&tx->payload_boc, &msg->payload), PAYLOAD_PARSING_ERROR);
+                tx->hints_data_len += tx->payload_boc.data_len;
+                expect_field(p, TX_STATE_HAS_HINTS, 1);
+            }
+        } else if (p->state == TX_STATE_HINTS_DATA) {
+            // Hints data is kept for display
+            size_t len = available < p->remaining ? available : p->remaining;
+            memmove(msg->hints_data + msg->hints_len - p->remaining, data, len);
+            buffer_seek_cur(buf, len);
+            p->remaining -= len;
+            if (p->remaining == 0) {
+                p->state = TX_STATE_MESSAGE_DONE;
+            }
+        } else if (fill_field(p, buf)) {
+            buffer_t field = {.ptr = p->scratch, .size = p->field_len, .offset = 0};
+            parser_status_e status = consume_message_field(tx, msg, &field);
+            if (status != PARSING_OK) {
+                return status;
+            }
+        }
     }
 
-    tx->hints.hints_count = 0;
+    return PARSING_OK;
+}
+
+/**
+ * Parse the tag and order fields of a transaction.
+ */
+static parser_status_e consume_header_field(transaction_t *tx, buffer_t *field) {
+    tx_parser_t *p = &tx->parser;
+
+    if (p->state == TX_STATE_HEADER) {
+        SAFE(buffer_read_u8(field, &tx->tag), TAG_PARSING_ERROR);
+        if (tx->tag > 0x02) {  // Only 0x00, 0x01 and 0x02 are supported here
+            return TAG_PARSING_ERROR;
+        }
+        uint8_t len = 4 + 4;  // seqno and timeout
+        if (tx->tag >= 0x01) {
+            len += 4 + 1;  // subwallet and wallet op
+        }
+        if (tx->tag == 0x02) {
+            len += 1;  // number of messages
+        }
+        expect_field(p, TX_STATE_ORDER, len);
+        return PARSING_OK;
+    }
 
-    if (tx->tag == 0x01) {
-        SAFE(buffer_read_u32(buf, &tx->subwallet_id, BE), GENERAL_ERROR);
-        SAFE(buffer_read_bool(buf, &tx->include_wallet_op), GENERAL_ERROR);
+    if (tx->tag >= 0x01) {
+        SAFE(buffer_read_u32(field, &tx->subwallet_id, BE), GENERAL_ERROR);
+        SAFE(buffer_read_bool(field, &tx->include_wallet_op), GENERAL_ERROR);
     } else {
         tx->subwallet_id = DEFAULT_SUBWALLET_ID;
         tx->include_wallet_op = true;
     }
 
-    // Basic Transaction parameters
-    SAFE(buffer_read_u32(buf, &tx->seqno, BE), SEQ_PARSING_ERROR);
-    SAFE(buffer_read_u32(buf, &tx->timeout, BE), TIMEOUT_PARSING_ERROR);
-    SAFE(buffer_read_varuint(buf, &tx->value_len, tx->value_buf, MAX_VALUE_BYTES_LEN),
-         VALUE_PARSING_ERROR);
-    SAFE(buffer_read_address(buf, &tx->to), TO_PARSING_ERROR);
-    SAFE(buffer_read_bool(buf, &tx->bounce), BOUNCE_PARSING_ERROR);
-    SAFE(buffer_read_u8(buf, &tx->send_mode), SEND_MODE_PARSING_ERROR);
-
-    // state-init
-    SAFE(buffer_read_bool(buf, &tx->has_state_init), STATE_INIT_PARSING_ERROR);
-    if (tx->has_state_init) {
-        SAFE(buffer_read_cell_ref(buf, &tx->state_init), STATE_INIT_PARSING_ERROR);
+    SAFE(buffer_read_u32(field, &tx->seqno, BE), SEQ_PARSING_ERROR);
+    SAFE(buffer_read_u32(field, &tx->timeout, BE), TIMEOUT_PARSING_ERROR);
+
+    // Messages
+    if (tx->tag == 0x02) {
+        SAFE(buffer_read_u8(field, &tx->messages_count), MESSAGES_PARSING_ERROR);
+        if (tx->messages_count == 0 || tx->messages_count > MAX_MESSAGES) {
+            return MESSAGES_PARSING_ERROR;
+        }
+    } else {
+        tx->messages_count = 1;
     }
 
-    // Payload
-    SAFE(buffer_read_bool(buf, &tx->has_payload), PAYLOAD_PARSING_ERROR);
-    if (tx->has_payload) {
-        SAFE(buffer_read_cell_ref(buf, &tx->payload), STATE_INIT_PARSING_ERROR);
+    p->message = 0;
+    message_deserialize_init(tx);
+
+    return PARSING_OK;
+}
+
+/**
+ * Process the hints of a message once it has been received.
+ */
+static parser_status_e process_message(transaction_t *tx, message_t *msg, uint8_t index) {
+    // Make sure the message hints fit
+    uint8_t start = tx->hints.hints_count;
+    size_t max_hints = tx->messages_count > 1 ? MESSAGE_HEADER_HINTS : 0;
+    if (msg->has_hints || msg->payload_is_boc) {
+        max_hints += MAX_MESSAGE_HINTS;
     }
+    SAFE(start + max_hints <= MAX_HINTS, HINTS_PARSING_ERROR);
+
+    // Process hints
+    PROFILE_BEGIN(PROFILE_HINTS);
+    bool hints_ok = process_hints(tx, msg);
+    PROFILE_END(PROFILE_HINTS);
+    SAFE(hints_ok, HINTS_PARSING_ERROR);
 
-    // Hints
-    SAFE(buffer_read_bool(buf, &tx->has_hints), HINTS_PARSING_ERROR);
-    if (tx->has_hints) {
-        if (!tx->has_payload) {
-            return HINTS_PARSING_ERROR;
+    if (tx->messages_count > 1) {
+        parser_status_e status = add_message_hints(tx, msg, index, start);
+        if (status != PARSING_OK) {
+            return status;
         }
-        SAFE(buffer_read_u32(buf, &tx->hints_type, BE), HINTS_PARSING_ERROR);
-        SAFE(buffer_read_u16(buf, &tx->hints_len, BE), HINTS_PARSING_ERROR);
-        SAFE(buffer_read_ref(buf, &tx->hints_data, tx->hints_len), HINTS_PARSING_ERROR);
     }
 
-    // Process hints
-    SAFE(process_hints(tx), HINTS_PARSING_ERROR);
+    tx->is_blind |= msg->is_blind;
+
+    return PARSING_OK;
+}
+
+void transaction_deserialize_init(transaction_t *tx) {
+    clear_hints(&tx->hints);
+    tx->hints_data_len = 0;
+    tx->is_blind = false;
+    expect_field(&tx->parser, TX_STATE_HEADER, 1);
+}
+
+parser_status_e transaction_deserialize_chunk(buffer_t *buf, transaction_t *tx) {
+    tx_parser_t *p = &tx->parser;
+
+    while (buf->offset < buf->size) {
+        if (p->state == TX_STATE_DONE) {
+            return WRONG_LENGTH_ERROR;
+        }
+
+        if (p->state == TX_STATE_HEADER || p->state == TX_STATE_ORDER) {
+            if (fill_field(p, buf)) {
+                buffer_t field = {.ptr = p->scratch, .size = p->field_len, .offset = 0};
+                parser_status_e status = consume_header_field(tx, &field);
+                if (status != PARSING_OK) {
+                    return status;
+                }
+            }
+            continue;
+        }
+
+        message_t *msg = &tx->messages[p->message];
+        parser_status_e status = message_deserialize(buf, tx, msg);
+        if (status != PARSING_OK) {
+            return status;
+        }
+
+        if (p->state == TX_STATE_MESSAGE_DONE) {
+            status = process_message(tx, msg, p->message);
+            if (status != PARSING_OK) {
+                return status;
+            }
+            if (++p->message < tx->messages_count) {
+                message_deserialize_init(tx);
+            } else {
+                p->state = TX_STATE_DONE;
+            }
+        }
+    }
+
+    return PARSING_OK;
+}
+
+parser_status_e transaction_deserialize_finish(transaction_t *tx) {
+    SAFE(tx->parser.state == TX_STATE_DONE, WRONG_LENGTH_ERROR);
+
+    // Operation
+    if (tx->messages_count == 1) {
+        snprintf(tx->title, sizeof(tx->title), "%s", tx->messages[0].title);
+        snprintf(tx->action, sizeof(tx->action), "%s", tx->messages[0].action);
+        snprintf(tx->recipient, sizeof(tx->recipient), "%s", tx->messages[0].recipient);
+    } else {
+        snprintf(tx->title, sizeof(tx->title), "Send %d messages", tx->messages_count);
+        snprintf(tx->action, sizeof(tx->action), "send %d messages", tx->messages_count);
+        snprintf(tx->recipient, sizeof(tx->recipient), "To");
+    }
 
     if (tx->subwallet_id != DEFAULT_SUBWALLET_ID) {
-        add_hint_number(&tx->hints, "Subwallet ID", (uint64_t) tx->subwallet_id);
+        SAFE(add_hint_number(&tx->hints, "Subwallet ID", (uint64_t) tx->subwallet_id),
+             HINTS_PARSING_ERROR);
+    }
+
+    return PARSING_OK;
+}
+
+parser_status_e transaction_deserialize(buffer_t *buf, transaction_t *tx) {
+    transaction_deserialize_init(tx);
+
+    parser_status_e status = transaction_deserialize_chunk(buf, tx);
+    if (status != PARSING_OK) {
+        return status;
     }
 
-    return (buf->offset == buf->size) ? PARSING_OK : WRONG_LENGTH_ERROR;
+    return transaction_deserialize_finish(tx);
 }
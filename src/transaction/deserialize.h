@@ -11,7 +11,40 @@ bool buffer_read_address(buffer_t *buf, address_t *out);
 bool buffer_read_cell_ref(buffer_t *buf, CellRef_t *out);
 
 /**
- * Deserialize raw transaction in structure.
+ * Start the incremental deserialization of a transaction.
+ *
+ * @param[out] tx
+ *   Pointer to transaction structure.
+ *
+ */
+void transaction_deserialize_init(transaction_t *tx);
+
+/**
+ * Deserialize a chunk of a raw transaction, chunks may split fields anywhere.
+ *
+ * @param[in, out] buf
+ *   Pointer to buffer with the chunk.
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e transaction_deserialize_chunk(buffer_t *buf, transaction_t *tx);
+
+/**
+ * Check that the whole transaction was received and set its operation.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e transaction_deserialize_finish(transaction_t *tx);
+
+/**
+ * Deserialize a whole raw transaction in structure.
  *
  * @param[in, out] buf
  *   Pointer to buffer with serialized transaction.
@@ -22,3 +55,28 @@ bool buffer_read_cell_ref(buffer_t *buf, CellRef_t *out);
  *
  */
 parser_status_e transaction_deserialize(buffer_t *buf, transaction_t *tx);
+
+/**
+ * Start the incremental deserialization of a message.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ */
+void message_deserialize_init(transaction_t *tx);
+
+/**
+ * Deserialize a chunk of a message of an order, without processing its hints. The
+ * parser state is TX_STATE_MESSAGE_DONE once the whole message has been received.
+ *
+ * @param[in, out] buf
+ *   Pointer to buffer with the chunk.
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ * @param[out]     msg
+ *   Pointer to message of the transaction.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e message_deserialize(buffer_t *buf, transaction_t *tx, message_t *msg);
@@ -4,6 +4,19 @@
 
 #include "../types.h"
 
+/**
+ * Computes the hash of an internal message
+ *
+ * @param[in]  msg
+ *   Pointer to message structure.
+ * @param[out] out
+ *   Pointer to message cell reference.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hash_message(message_t *msg, CellRef_t *out);
+
 /**
  * Computes transaction hash for signing
  *
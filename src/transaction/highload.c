@@ -0,0 +1,141 @@
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stdio.h>    // snprintf
+#include <string.h>   // memmove
+
+#include "highload.h"
+
+#include "deserialize.h"
+#include "hash.h"
+#include "out_list.h"
+#include "../common/bits.h"
+#include "../common/cell.h"
+#include "../common/hints.h"
+#include "../constants.h"
+
+#define SAFE(RES, CODE) \
+    if (!(RES)) {       \
+        return CODE;    \
+    }
+
+/**
+ * Hints summarizing the order in addition to the ones of the action list:
+ * wallet, subwallet, amount and send mode of the internal_transfer.
+ */
+#define HIGHLOAD_SUMMARY_HINTS (OUT_LIST_SUMMARY_HINTS + 4)
+
+parser_status_e highload_deserialize_header(buffer_t *buf, transaction_t *tx) {
+    highload_t *hl = &tx->highload;
+    message_t *transfer = &hl->transfer;
+    uint8_t actions_count;
+
+    // tag
+    SAFE(buffer_read_u8(buf, &tx->tag), TAG_PARSING_ERROR);
+    if (tx->tag != HIGHLOAD_TAG) {
+        return TAG_PARSING_ERROR;
+    }
+
+    clear_hints(&tx->hints);
+    tx->messages_count = 0;
+    tx->is_blind = false;
+
+    // Order parameters
+    SAFE(buffer_read_u32(buf, &tx->subwallet_id, BE), GENERAL_ERROR);
+    SAFE(buffer_read_u32(buf, &hl->query_id, BE), SEQ_PARSING_ERROR);
+    SAFE(hl->query_id < (1 << 23), SEQ_PARSING_ERROR);
+    SAFE(buffer_read_u64(buf, &hl->created_at, BE), TIMEOUT_PARSING_ERROR);
+    SAFE(buffer_read_u32(buf, &tx->timeout, BE), TIMEOUT_PARSING_ERROR);
+    SAFE(tx->timeout < (1 << 22), TIMEOUT_PARSING_ERROR);
+
+    // internal_transfer message to the wallet itself
+    SAFE(buffer_read_varuint(buf, &transfer->value_len, transfer->value_buf, MAX_VALUE_BYTES_LEN),
+         VALUE_PARSING_ERROR);
+    SAFE(buffer_read_address(buf, &transfer->to), TO_PARSING_ERROR);
+    SAFE(buffer_read_bool(buf, &transfer->bounce), BOUNCE_PARSING_ERROR);
+    SAFE(buffer_read_u8(buf, &transfer->send_mode), SEND_MODE_PARSING_ERROR);
+    SAFE(buffer_read_u64(buf, &hl->transfer_query_id, BE), GENERAL_ERROR);
+    transfer->has_state_init = false;
+
+    // Actions
+    SAFE(buffer_read_u8(buf, &actions_count), MESSAGES_PARSING_ERROR);
+    if (actions_count == 0 || actions_count > HIGHLOAD_MAX_ACTIONS) {
+        return MESSAGES_PARSING_ERROR;
+    }
+    SAFE(out_list_init(tx, actions_count, HIGHLOAD_SUMMARY_HINTS), GENERAL_ERROR);
+
+    return PARSING_OK;
+}
+
+parser_status_e highload_finalize(transaction_t *tx) {
+    highload_t *hl = &tx->highload;
+    uint8_t count = tx->hints.hints_count;
+
+    parser_status_e status = out_list_finalize(tx);
+    if (status != PARSING_OK) {
+        return status;
+    }
+
+    // Summary
+    SAFE(add_hint_address(&tx->hints, "Highload wallet", hl->transfer.to, hl->transfer.bounce),
+         HINTS_PARSING_ERROR);
+    SAFE(add_hint_number(&tx->hints, "Subwallet ID", (uint64_t) tx->subwallet_id),
+         HINTS_PARSING_ERROR);
+    SAFE(add_hint_amount(&tx->hints,
+                         "Transfer amount",
+                         "TON",
+                         hl->transfer.value_buf,
+                         hl->transfer.value_len,
+                         EXPONENT_SMALLEST_UNIT),
+         HINTS_PARSING_ERROR);
+    SAFE(add_hint_number(&tx->hints, "Transfer mode", hl->transfer.send_mode),
+         HINTS_PARSING_ERROR);
+
+    // The internal_transfer is not checked to be sent to the wallet of the signing key, whose
+    // address can not be derived without the highload wallet v3 code
+    tx->is_blind = true;
+
+    move_hints_before(&tx->hints, 0, tx->hints.hints_count - count);
+
+    // Operation
+    snprintf(tx->title, sizeof(tx->title), "Send %d messages", tx->out_list.count);
+    snprintf(tx->action, sizeof(tx->action), "send %d messages", tx->out_list.count);
+    snprintf(tx->recipient, sizeof(tx->recipient), "To");
+
+    return PARSING_OK;
+}
+
+bool hash_highload(transaction_ctx_t *ctx) {
+    highload_t *hl = &ctx->transaction.highload;
+    BitString_t bits;
+    CellRef_t transferRef;
+    CellRef_t orderRef;
+
+    // internal_transfer#ae42e5a4 {n:#} query_id:uint64 actions:^(OutList n) = InternalMsgBody n;
+    BitString_init(&bits);
+    BitString_storeUint(&bits, 0xae42e5a4, 32);
+    BitString_storeUint(&bits, hl->transfer_query_id, 64);
+    if (!hash_Cell(&bits, &ctx->transaction.out_list.ref, 1, &hl->transfer.payload)) {
+        return false;
+    }
+    hl->transfer.has_payload = true;
+
+    if (!hash_message(&hl->transfer, &transferRef)) {
+        return false;
+    }
+
+    // Order
+    BitString_init(&bits);
+    BitString_storeUint(&bits, ctx->transaction.subwallet_id, 32);  // Subwallet ID
+    BitString_storeUint(&bits, hl->transfer.send_mode, 8);          // Send Mode
+    BitString_storeUint(&bits, hl->query_id, 23);                   // Query ID
+    BitString_storeUint(&bits, hl->created_at, 64);                 // Created at
+    BitString_storeUint(&bits, ctx->transaction.timeout, 22);       // Timeout
+    if (!hash_Cell(&bits, &transferRef, 1, &orderRef)) {
+        return false;
+    }
+
+    // Result
+    memmove(ctx->m_hash, orderRef.hash, HASH_LEN);
+
+    return true;
+}
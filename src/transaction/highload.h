@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+
+#include "types.h"
+#include "../types.h"
+#include "../common/buffer.h"
+
+/**
+ * Tag of transaction requests for highload wallet v3 orders.
+ */
+#define HIGHLOAD_TAG 0x03
+
+/**
+ * Max number of actions in one internal_transfer of a highload wallet v3.
+ */
+#define HIGHLOAD_MAX_ACTIONS 254
+
+/**
+ * Deserialize the header of a highload wallet v3 order.
+ *
+ * @param[in, out] buf
+ *   Pointer to buffer with serialized header.
+ * @param[out]     tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e highload_deserialize_header(buffer_t *buf, transaction_t *tx);
+
+/**
+ * Check that all actions were received and add the hints summarizing the order.
+ * Actions are deserialized with out_list_deserialize.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e highload_finalize(transaction_t *tx);
+
+/**
+ * Computes the hash of a highload wallet v3 order for signing
+ *
+ * @param[in, out] ctx
+ *   Pointer to transaction context.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hash_highload(transaction_ctx_t *ctx);
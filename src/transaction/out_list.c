@@ -0,0 +1,149 @@
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <string.h>   // memset
+
+#include "out_list.h"
+
+#include "deserialize.h"
+#include "hash.h"
+#include "../common/bits.h"
+#include "../common/cell.h"
+#include "../common/hints.h"
+#include "../constants.h"
+
+#define SAFE(RES, CODE) \
+    if (!(RES)) {       \
+        return CODE;    \
+    }
+
+/**
+ * Add a big endian value to a big endian total of MAX_VALUE_BYTES_LEN bytes.
+ */
+static bool add_value(uint8_t *total, const uint8_t *value, uint8_t value_len) {
+    uint16_t carry = 0;
+
+    for (uint8_t i = 0; i < MAX_VALUE_BYTES_LEN; i++) {
+        uint16_t sum = total[MAX_VALUE_BYTES_LEN - 1 - i] + carry;
+        if (i < value_len) {
+            sum += value[value_len - 1 - i];
+        }
+        total[MAX_VALUE_BYTES_LEN - 1 - i] = (uint8_t) sum;
+        carry = sum >> 8;
+    }
+
+    return carry == 0;
+}
+
+bool out_list_init(transaction_t *tx, uint8_t count, uint8_t reserved_hints) {
+    out_list_t *list = &tx->out_list;
+    BitString_t bits;
+
+    tx->hints_data_len = 0;
+    message_deserialize_init(tx);
+
+    memset(list, 0, sizeof(out_list_t));
+    list->count = count;
+    list->reserved_hints = reserved_hints;
+
+    // out_list_empty$_ = OutList 0;
+    BitString_init(&bits);
+    return hash_Cell(&bits, NULL, 0, &list->ref);
+}
+
+parser_status_e out_list_deserialize(buffer_t *buf, transaction_t *tx) {
+    out_list_t *list = &tx->out_list;
+    message_t *msg = &tx->send_action;
+    BitString_t bits;
+    CellRef_t out_msg;
+
+    while (buf->offset < buf->size) {
+        SAFE(list->received < list->count, MESSAGES_PARSING_ERROR);
+
+        parser_status_e status = message_deserialize(buf, tx, msg);
+        if (status != PARSING_OK) {
+            return status;
+        }
+        if (tx->parser.state != TX_STATE_MESSAGE_DONE) {
+            break;  // rest of the action is in the next chunk
+        }
+
+        // Payloads are not decoded, there is no room for their hints
+        SAFE(!msg->payload_is_boc, PAYLOAD_PARSING_ERROR);
+        SAFE(!msg->has_hints, HINTS_PARSING_ERROR);
+        if (msg->has_payload || msg->has_state_init) {
+            tx->is_blind = true;
+        }
+
+        // action_send_msg#0ec3c86d mode:(## 8) out_msg:^(MessageRelaxed Any) = OutAction;
+        // out_list$_ {n:#} prev:^(OutList n) action:OutAction = OutList (n + 1);
+        SAFE(hash_message(msg, &out_msg), GENERAL_ERROR);
+        BitString_init(&bits);
+        BitString_storeUint(&bits, 0x0ec3c86d, 32);
+        BitString_storeUint(&bits, msg->send_mode, 8);
+        CellRef_t refs[2] = {list->ref, out_msg};
+        SAFE(hash_Cell(&bits, refs, 2, &list->ref), GENERAL_ERROR);
+
+        // Totals
+        if ((msg->send_mode & 128) != 0) {
+            list->total_all = true;
+        } else {
+            SAFE(add_value(list->total, msg->value_buf, msg->value_len), VALUE_PARSING_ERROR);
+        }
+
+        // Recipients, as long as they fit
+        if (hints_fit(&tx->hints, 2 + list->reserved_hints)) {
+            SAFE(add_hint_address(&tx->hints, "Recipient", msg->to, msg->bounce),
+                 HINTS_PARSING_ERROR);
+            if ((msg->send_mode & 128) != 0) {
+                SAFE(add_hint_text(&tx->hints, "Amount", "ALL YOUR TONs", 13), HINTS_PARSING_ERROR);
+            } else {
+                SAFE(add_hint_amount(&tx->hints,
+                                     "Amount",
+                                     "TON",
+                                     msg->value_buf,
+                                     msg->value_len,
+                                     EXPONENT_SMALLEST_UNIT),
+                     HINTS_PARSING_ERROR);
+            }
+        } else {
+            list->recipients_hidden++;
+        }
+
+        list->received++;
+        message_deserialize_init(tx);
+    }
+
+    return PARSING_OK;
+}
+
+parser_status_e out_list_finalize(transaction_t *tx) {
+    out_list_t *list = &tx->out_list;
+
+    SAFE(list->received == list->count, MESSAGES_PARSING_ERROR);
+
+    if (list->count == 0) {
+        return PARSING_OK;
+    }
+
+    SAFE(add_hint_number(&tx->hints, "Messages", list->count), HINTS_PARSING_ERROR);
+    if (list->total_all) {
+        SAFE(add_hint_text(&tx->hints, "Total amount", "ALL YOUR TONs", 13), HINTS_PARSING_ERROR);
+    } else {
+        SAFE(add_hint_amount(&tx->hints,
+                             "Total amount",
+                             "TON",
+                             list->total,
+                             sizeof(list->total),
+                             EXPONENT_SMALLEST_UNIT),
+             HINTS_PARSING_ERROR);
+    }
+
+    // Recipients which are not displayed can not be reviewed
+    if (list->recipients_hidden > 0) {
+        SAFE(add_hint_number(&tx->hints, "Recipients not shown", list->recipients_hidden),
+             HINTS_PARSING_ERROR);
+        tx->is_blind = true;
+    }
+
+    return PARSING_OK;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "types.h"
+#include "../common/buffer.h"
+
+/**
+ * Hints added by out_list_finalize: messages, total amount and recipients not shown.
+ */
+#define OUT_LIST_SUMMARY_HINTS 3
+
+/**
+ * Start an empty list of send actions.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ * @param[in]      count
+ *   Number of actions announced.
+ * @param[in]      reserved_hints
+ *   Number of hints kept for the summary of the order, including OUT_LIST_SUMMARY_HINTS.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool out_list_init(transaction_t *tx, uint8_t count, uint8_t reserved_hints);
+
+/**
+ * Deserialize and hash send actions, actions may be split between chunks.
+ * Recipients and amounts are added to the hints as long as they fit.
+ *
+ * @param[in, out] buf
+ *   Pointer to buffer with serialized actions.
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e out_list_deserialize(buffer_t *buf, transaction_t *tx);
+
+/**
+ * Check that all actions were received and add the hints summarizing them.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e out_list_finalize(transaction_t *tx);
@@ -0,0 +1,122 @@
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "request.h"
+
+#include "deserialize.h"
+#include "hash.h"
+#include "highload.h"
+#include "out_list.h"
+#include "w5.h"
+#include "../common/profile.h"
+
+/**
+ * Whether requests with this tag are orders whose actions are hashed into an out list.
+ */
+static bool is_streamed(uint8_t tag) {
+    return tag == HIGHLOAD_TAG || tag == W5_TAG;
+}
+
+/**
+ * Add a big endian value to a sum, false if the sum does not fit in 64 bits.
+ */
+static bool add_amount(uint64_t *sum, const uint8_t *value, uint8_t value_len) {
+    uint64_t v = 0;
+
+    for (uint8_t i = 0; i < value_len; i++) {
+        if (v > (UINT64_MAX >> 8)) {
+            return false;
+        }
+        v = (v << 8) | value[i];
+    }
+    if (v > UINT64_MAX - *sum) {
+        return false;
+    }
+    *sum += v;
+
+    return true;
+}
+
+static parser_status_e deserialize_chunk(buffer_t *buf, transaction_t *tx, bool last) {
+    parser_status_e status = PARSING_OK;
+
+    bool started = tx->parser.state != TX_STATE_HEADER || tx->parser.scratch_len > 0;
+    if (!started && buf->size > buf->offset && buf->ptr[buf->offset] == HIGHLOAD_TAG) {
+        status = highload_deserialize_header(buf, tx);
+    } else if (!started && buf->size > buf->offset && buf->ptr[buf->offset] == W5_TAG) {
+        status = w5_deserialize_header(buf, tx);
+    }
+    if (status == PARSING_OK) {
+        status = is_streamed(tx->tag) ? out_list_deserialize(buf, tx)
+                                      : transaction_deserialize_chunk(buf, tx);
+    }
+    if (status != PARSING_OK || !last) {
+        return status;
+    }
+
+    switch (tx->tag) {
+        case HIGHLOAD_TAG:
+            return highload_finalize(tx);
+        case W5_TAG:
+            return w5_finalize(tx);
+        default:
+            return transaction_deserialize_finish(tx);
+    }
+}
+
+static bool hash_request(transaction_ctx_t *ctx) {
+    switch (ctx->transaction.tag) {
+        case HIGHLOAD_TAG:
+            return hash_highload(ctx);
+        case W5_TAG:
+            return hash_w5(ctx);
+        default:
+            return hash_tx(ctx);
+    }
+}
+
+parser_status_e request_deserialize_chunk(buffer_t *buf, transaction_t *tx, bool last) {
+    PROFILE_BEGIN(PROFILE_DESERIALIZE);
+    parser_status_e status = deserialize_chunk(buf, tx, last);
+    PROFILE_END(PROFILE_DESERIALIZE);
+
+    return status;
+}
+
+bool request_hash(transaction_ctx_t *ctx) {
+    PROFILE_BEGIN(PROFILE_HASH);
+    bool ok = hash_request(ctx);
+    PROFILE_END(PROFILE_HASH);
+
+    return ok;
+}
+
+bool request_sent_amount(const transaction_t *tx, uint64_t *amount) {
+    *amount = 0;
+
+    // Send mode 128 sends the whole balance, whatever the value of the message
+    if (is_streamed(tx->tag)) {
+        // Extensions added or allowed may spend the balance without any signature
+        if (tx->tag == W5_TAG && tx->w5.extended_count > 0) {
+            return false;
+        }
+        // The internal_transfer of a highload order carries its own value
+        const message_t *transfer = &tx->highload.transfer;
+        if (tx->tag == HIGHLOAD_TAG &&
+            ((transfer->send_mode & 128) != 0 ||
+             !add_amount(amount, transfer->value_buf, transfer->value_len))) {
+            return false;
+        }
+        return !tx->out_list.total_all &&
+               add_amount(amount, tx->out_list.total, MAX_VALUE_BYTES_LEN);
+    }
+
+    for (uint8_t i = 0; i < tx->messages_count; i++) {
+        const message_t *msg = &tx->messages[i];
+        if ((msg->send_mode & 128) != 0 || !add_amount(amount, msg->value_buf, msg->value_len)) {
+            return false;
+        }
+    }
+
+    return true;
+}
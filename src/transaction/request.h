@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+
+#include "types.h"
+#include "../types.h"
+#include "../common/buffer.h"
+
+/**
+ * Deserialize a chunk of a transaction request started with transaction_deserialize_init.
+ * The tag of the first chunk selects the
+ * parser: orders of highload wallets and wallets v5 start with their own header and
+ * their actions are hashed as they are received.
+ *
+ * @param[in, out] buf
+ *   Pointer to buffer with the chunk.
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ * @param[in]      last
+ *   Whether this is the last chunk of the request.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e request_deserialize_chunk(buffer_t *buf, transaction_t *tx, bool last);
+
+/**
+ * Compute the hash signed for a transaction request received entirely.
+ *
+ * @param[in, out] ctx
+ *   Pointer to transaction context, the hash is written to ctx->m_hash.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool request_hash(transaction_ctx_t *ctx);
+
+/**
+ * Sum the values sent by a transaction request received entirely, from its messages or
+ * from its send actions and the internal_transfer of a highload order.
+ *
+ * @param[in]  tx
+ *   Pointer to transaction structure.
+ * @param[out] amount
+ *   Amount sent (nanotons).
+ *
+ * @return true if success, false if the request may send the whole balance, has extended
+ * actions of a wallet v5 or the sum does not fit in 64 bits.
+ *
+ */
+bool request_sent_amount(const transaction_t *tx, uint64_t *amount);
@@ -0,0 +1,177 @@
+#include <stddef.h>  // size_t, NULL
+#include <stdint.h>  // uint*_t
+
+#include "os.h"
+
+#include "schema.h"
+#include "transaction_hints.h"
+
+#define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+static const schema_field_t comment_fields[] = {
+    {FIELD_TEXT, 0, 0, "Comment"},
+};
+
+static const schema_field_t jetton_transfer_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_COINS, 0, 0, "Jetton units"},
+    {FIELD_ADDRESS, 0, 0, "Send jetton to"},
+    {FIELD_ADDRESS, FIELD_FLAG_EXPERT, 0, "Send excess to"},
+    {FIELD_MAYBE_REF, FIELD_FLAG_EXPERT, 0, "Custom payload"},
+    {FIELD_COINS, FIELD_FLAG_EXPERT | FIELD_FLAG_TON, 0, "Forward amount"},
+    {FIELD_EITHER_REF, FIELD_FLAG_EXPERT, 0, "Forward payload"},
+};
+
+static const schema_field_t nft_transfer_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_ADDRESS, 0, 0, "New owner"},
+    {FIELD_ADDRESS, FIELD_FLAG_EXPERT, 0, "Send excess to"},
+    {FIELD_MAYBE_REF, FIELD_FLAG_EXPERT, 0, "Custom payload"},
+    {FIELD_COINS, FIELD_FLAG_EXPERT | FIELD_FLAG_TON, 0, "Forward amount"},
+    {FIELD_EITHER_REF, FIELD_FLAG_EXPERT, 0, "Forward payload"},
+};
+
+static const schema_field_t jetton_burn_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_COINS, 0, 0, "Jetton units"},
+    {FIELD_ADDRESS, FIELD_FLAG_EXPERT, 0, "Send excess to"},
+    {FIELD_MAYBE_INLINE_REF, FIELD_FLAG_EXPERT, 0, "Custom payload"},
+};
+
+static const schema_field_t add_whitelist_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_ADDRESS, 0, 0, "New whitelist"},
+};
+
+static const schema_field_t single_nominator_withdraw_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_COINS, FIELD_FLAG_TON, 0, "Withdraw amount"},
+};
+
+static const schema_field_t single_nominator_change_validator_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_ADDRESS, 0, 0, "New validator"},
+};
+
+static const schema_field_t tonstakers_deposit_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_OPT_UINT, 0, 8, NULL},  // app_id
+};
+
+static const schema_field_t jetton_dao_vote_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_ADDRESS, FIELD_FLAG_BOUNCEABLE, 0, "Voting address"},
+    {FIELD_UINT, 0, 6, "Expiration time"},
+    {FIELD_BOOL, 0, 0, "Vote"},
+    {FIELD_BOOL, 0, 0, NULL},  // need_confirmation
+};
+
+static const schema_field_t change_dns_record_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_DNS_RECORD, 0, 0, NULL},
+};
+
+static const schema_field_t token_bridge_pay_swap_fields[] = {
+    {FIELD_QUERY_ID, 0, 0, NULL},
+    {FIELD_BYTES, 0, 32, "Transfer ID"},
+};
+
+#define SCHEMA(op, title, action, recipient, fields) \
+    { op, title, action, recipient, fields, ARRAY_LEN(fields) }
+
+/**
+ * Known messages, indexed by hints type.
+ */
+static const message_schema_t schemas[] = {
+    [TRANSACTION_COMMENT] = SCHEMA(0x00000000, "Transfer", "send TON", "To", comment_fields),
+    [TRANSACTION_TRANSFER_JETTON] = SCHEMA(0x0f8a7ea5,
+                                           "Transfer jetton",
+                                           "transfer jetton",
+                                           "Jetton wallet",
+                                           jetton_transfer_fields),
+    [TRANSACTION_TRANSFER_NFT] =
+        SCHEMA(0x5fcc3d14, "Transfer NFT", "transfer NFT", "NFT Address", nft_transfer_fields),
+    [TRANSACTION_BURN_JETTON] =
+        SCHEMA(0x595f07bc, "Burn jetton", "burn jetton", "Jetton wallet", jetton_burn_fields),
+    [TRANSACTION_ADD_WHITELIST] = SCHEMA(0x7258a69b,
+                                         "Add whitelist",
+                                         "add whitelist",
+                                         "Vesting wallet",
+                                         add_whitelist_fields),
+    [TRANSACTION_SINGLE_NOMINATOR_WITHDRAW] = SCHEMA(0x00001000,
+                                                     "Withdraw stake",
+                                                     "withdraw from nominator",
+                                                     "Single Nominator",
+                                                     single_nominator_withdraw_fields),
+    [TRANSACTION_SINGLE_NOMINATOR_CHANGE_VALIDATOR] =
+        SCHEMA(0x00001001,
+               "Edit validator",
+               "change validator",
+               "Single Nominator",
+               single_nominator_change_validator_fields),
+    [TRANSACTION_TONSTAKERS_DEPOSIT] = SCHEMA(0x47d54391,
+                                              "Deposit stake",
+                                              "deposit stake",
+                                              "Pool",
+                                              tonstakers_deposit_fields),
+    [TRANSACTION_JETTON_DAO_VOTE] = SCHEMA(0x69fb306c,
+                                           "Vote proposal",
+                                           "vote for proposal",
+                                           "Jetton wallet",
+                                           jetton_dao_vote_fields),
+    [TRANSACTION_CHANGE_DNS_RECORD] = SCHEMA(0x4eb1f0f9,
+                                             "Change DNS",
+                                             "change DNS record",
+                                             "DNS resolver",
+                                             change_dns_record_fields),
+    [TRANSACTION_TOKEN_BRIDGE_PAY_SWAP] = SCHEMA(0x00000008,
+                                                 "Bridge tokens",
+                                                 "bridge tokens",
+                                                 "Bridge",
+                                                 token_bridge_pay_swap_fields),
+};
+
+/**
+ * Hints types sorted by opcode of their message.
+ */
+static const uint8_t schemas_by_op[] = {
+    TRANSACTION_COMMENT,                            // 0x00000000
+    TRANSACTION_TOKEN_BRIDGE_PAY_SWAP,              // 0x00000008
+    TRANSACTION_SINGLE_NOMINATOR_WITHDRAW,          // 0x00001000
+    TRANSACTION_SINGLE_NOMINATOR_CHANGE_VALIDATOR,  // 0x00001001
+    TRANSACTION_TRANSFER_JETTON,                    // 0x0f8a7ea5
+    TRANSACTION_TONSTAKERS_DEPOSIT,                 // 0x47d54391
+    TRANSACTION_CHANGE_DNS_RECORD,                  // 0x4eb1f0f9
+    TRANSACTION_BURN_JETTON,                        // 0x595f07bc
+    TRANSACTION_TRANSFER_NFT,                       // 0x5fcc3d14
+    TRANSACTION_JETTON_DAO_VOTE,                    // 0x69fb306c
+    TRANSACTION_ADD_WHITELIST,                      // 0x7258a69b
+};
+
+const message_schema_t *schema_from_hints_type(uint32_t hints_type) {
+    if (hints_type >= ARRAY_LEN(schemas)) {
+        return NULL;
+    }
+
+    return (const message_schema_t *) PIC(&schemas[hints_type]);
+}
+
+const message_schema_t *schema_from_op(uint32_t op) {
+    size_t lo = 0;
+    size_t hi = ARRAY_LEN(schemas_by_op);
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        const message_schema_t *schema = schema_from_hints_type(schemas_by_op[mid]);
+        if (schema->op == op) {
+            return schema;
+        }
+        if (schema->op < op) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>  // uint*_t
+
+/**
+ * Enumeration with kinds of message body fields.
+ *
+ * Each kind has a hints encoding (see MESSAGES.md) and a cell encoding (TL-B).
+ */
+typedef enum {
+    FIELD_QUERY_ID,          /// query_id:uint64, optional in hints (0 if absent)
+    FIELD_UINT,              /// uint(8 * size), big endian in hints
+    FIELD_OPT_UINT,          /// trailing uint(8 * size), only stored if present
+    FIELD_COINS,             /// VarUInteger 16, varuint in hints
+    FIELD_ADDRESS,           /// MsgAddressInt, standard addresses only
+    FIELD_BOOL,              /// Bool
+    FIELD_BYTES,             /// bits(8 * size)
+    FIELD_MAYBE_REF,         /// Maybe ^Cell
+    FIELD_EITHER_REF,        /// Either Cell ^Cell, only the reference or an empty cell
+    FIELD_MAYBE_INLINE_REF,  /// Maybe ^Cell, which hints may pass as cell_inline
+    FIELD_TEXT,              /// ASCII text up to the end of the cell
+    FIELD_DNS_RECORD,        /// change_dns_record key and value, hints only
+} field_kind_e;
+
+#define FIELD_FLAG_EXPERT     0x01  /// hint only displayed in expert mode
+#define FIELD_FLAG_BOUNCEABLE 0x02  /// address displayed as bounceable
+#define FIELD_FLAG_TON        0x04  /// amount in TON, raw units otherwise
+
+/**
+ * Structure for a message body field, hint is not displayed if label is NULL.
+ */
+typedef struct {
+    uint8_t kind;       /// field_kind_e
+    uint8_t flags;      /// FIELD_FLAG_*
+    uint8_t size;       /// size in bytes for FIELD_UINT, FIELD_OPT_UINT and FIELD_BYTES
+    const char *label;  /// hint title
+} schema_field_t;
+
+/**
+ * Structure for a known message body: opcode followed by fields.
+ */
+typedef struct {
+    uint32_t op;
+    const char *title;
+    const char *action;
+    const char *recipient;
+    const schema_field_t *fields;
+    uint8_t fields_count;
+} message_schema_t;
+
+/**
+ * Get the schema of a message by its hints type.
+ *
+ * @return pointer to schema, NULL if unknown.
+ *
+ */
+const message_schema_t *schema_from_hints_type(uint32_t hints_type);
+
+/**
+ * Get the schema of a message by its opcode.
+ *
+ * @return pointer to schema, NULL if unknown.
+ *
+ */
+const message_schema_t *schema_from_op(uint32_t op);
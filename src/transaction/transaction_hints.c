@@ -4,575 +4,462 @@
 #include "transaction_hints.h"
 
 #include "../common/buffer.h"
-#include "../common/base64.h"
-#include "../common/format_bigint.h"
-#include "../common/format_address.h"
 #include "../common/encoding.h"
 #include "../constants.h"
 #include "deserialize.h"
+#include "schema.h"
 #include "../common/hints.h"
 #include "../common/bits.h"
 #include "../common/cell.h"
+#include "../common/boc.h"
 #include "../globals.h"
 
 #define SAFE(RES)     \
-    if (!RES) {       \
+    if (!(RES)) {     \
         return false; \
     }
 
-#define CHECK_END()               \
-    if (buf.offset != buf.size) { \
-        return false;             \
-    }
-
 static const uint8_t dns_key_wallet[32] = {
     0xe8, 0xd4, 0x40, 0x50, 0x87, 0x3d, 0xba, 0x86, 0x5a, 0xa7, 0xc1, 0x70, 0xab, 0x4c, 0xce, 0x64,
     0xd9, 0x08, 0x39, 0xa3, 0x4d, 0xcf, 0xd6, 0xcf, 0x71, 0xd1, 0x4e, 0x02, 0x05, 0x44, 0x3b, 0x1b};
 
-bool process_hints(transaction_t* tx) {
-    // Default title
-    snprintf(tx->title, sizeof(tx->title), "Transaction");
-    snprintf(tx->action, sizeof(tx->action), "send TON");
-    snprintf(tx->recipient, sizeof(tx->recipient), "To");
-
-    // No payload
-    if (!tx->has_payload) {
-        snprintf(tx->title, sizeof(tx->title), "Transfer");
-        tx->is_blind = false;
-        return true;
+/**
+ * Message body being read, either from hints (then the body cell is rebuilt
+ * to be checked against the payload hash) or from the payload cells.
+ */
+typedef struct {
+    buffer_t* buf;       // hints data, NULL when reading payload cells
+    CellSlice_t* slice;  // payload root cell, NULL when reading hints
+    BitString_t bits;    // body rebuilt from hints
+    CellRef_t refs[CELL_MAX_REFS];
+    uint8_t refs_count;
+} body_reader_t;
+
+static bool read_uint(body_reader_t* r, uint8_t size, uint64_t* out) {
+    if (r->slice != NULL) {
+        return CellSlice_loadUint(r->slice, size * 8, out);
     }
-    // No hints
-    if (!tx->has_hints) {
-        tx->is_blind = true;
-        return true;
+
+    uint8_t data[8];
+    SAFE(size <= sizeof(data));
+    SAFE(buffer_read_buffer(r->buf, data, size));
+    *out = 0;
+    for (uint8_t i = 0; i < size; i++) {
+        *out = (*out << 8) | data[i];
     }
+    BitString_storeUint(&r->bits, *out, size * 8);
 
-    // Default state
-    tx->is_blind = true;
-    CellRef_t cell;
-    BitString_t bits;
-    bool hasCell = false;
-    bool tmp = false;
-    buffer_t buf = {.ptr = tx->hints_data, .size = tx->hints_len, .offset = 0};
-
-    //
-    // Comment
-    //
-
-    if (tx->hints_type == TRANSACTION_COMMENT) {
-        // Max size of a comment is 120 symbols
-        if (tx->hints_len > MAX_MEMO_LEN) {
-            return false;
-        }
+    return true;
+}
 
-        // Check ASCII
-        if (!check_ascii(tx->hints_data, tx->hints_len)) {
-            return false;
-        }
+static bool read_ref(body_reader_t* r, CellRef_t* out) {
+    if (r->slice != NULL) {
+        return CellSlice_loadRefHash(r->slice, out);
+    }
 
-        // Build cell
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0, 32);
-        BitString_storeBuffer(&bits, tx->hints_data, tx->hints_len);
-        SAFE(hash_Cell(&bits, NULL, 0, &cell));
-        hasCell = true;
+    SAFE(r->refs_count < CELL_MAX_REFS);
+    SAFE(buffer_read_cell_ref(r->buf, out));
+    r->refs[r->refs_count++] = *out;
 
-        // Change title of operation
-        snprintf(tx->title, sizeof(tx->title), "Transfer");
+    return true;
+}
 
-        // Add code hints
-        add_hint_text(&tx->hints, "Comment", (char*) tx->hints_data, tx->hints_len);
+static bool read_text(transaction_t* tx, body_reader_t* r, const char* label) {
+    const uint8_t* text;
+    size_t len;
+
+    if (r->slice != NULL) {
+        // Only single cell comments
+        uint16_t bits = CellSlice_remainingBits(r->slice);
+        SAFE(bits % 8 == 0 && CellSlice_remainingRefs(r->slice) == 0);
+        len = bits / 8;
+        SAFE(len <= MAX_MEMO_LEN);
+        SAFE(CellSlice_loadBufferRef(r->slice, &text, len));
+    } else {
+        len = buffer_remaining(r->buf);
+        SAFE(len <= MAX_MEMO_LEN);
+        SAFE(buffer_read_ref(r->buf, (uint8_t**) &text, len));
+        BitString_storeBuffer(&r->bits, text, len);
     }
 
-    if (tx->hints_type == TRANSACTION_TRANSFER_JETTON ||
-        tx->hints_type == TRANSACTION_TRANSFER_NFT) {
-        int ref_count = 0;
-        CellRef_t refs[2] = {0};
-
-        BitString_init(&bits);
-        BitString_storeUint(&bits,
-                            tx->hints_type == TRANSACTION_TRANSFER_JETTON ? 0x0f8a7ea5 : 0x5fcc3d14,
-                            32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
-        }
-
-        if (tx->hints_type == TRANSACTION_TRANSFER_JETTON) {
-            uint8_t amount_size;
-            uint8_t amount_buf[MAX_VALUE_BYTES_LEN];
-            SAFE(buffer_read_varuint(&buf, &amount_size, amount_buf, MAX_VALUE_BYTES_LEN));
-            BitString_storeCoinsBuf(&bits, amount_buf, amount_size);
-
-            add_hint_amount(&tx->hints, "Jetton units", "", amount_buf, amount_size, 0);
-        }
+    SAFE(check_ascii(text, len));
 
-        address_t destination;
-        SAFE(buffer_read_address(&buf, &destination));
-        BitString_storeAddress(&bits, destination.chain, destination.hash);
+    SAFE(add_hint_text(&tx->hints, label, (const char*) text, len));
 
-        add_hint_address(
-            &tx->hints,
-            tx->hints_type == TRANSACTION_TRANSFER_JETTON ? "Send jetton to" : "New owner",
-            destination,
-            false);
+    return true;
+}
 
-        address_t response;
-        SAFE(buffer_read_address(&buf, &response));
-        BitString_storeAddress(&bits, response.chain, response.hash);
+static bool read_inline_ref(transaction_t* tx, body_reader_t* r, const char* label) {
+    uint8_t type = 0x00;
+    CellRef_t ref;
 
-        if (N_storage.expert_mode) {
-            add_hint_address(&tx->hints, "Send excess to", response, false);
+    if (r->slice != NULL) {
+        bool has_ref;
+        SAFE(CellSlice_loadBit(r->slice, &has_ref));
+        if (!has_ref) {
+            return true;
         }
 
-        // custom payload
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            SAFE(buffer_read_cell_ref(&buf, &refs[ref_count]));
+        // Display short byte strings like cell_inline does
+        uint8_t index;
+        CellSlice_t inner;
+        SAFE(CellSlice_loadRef(r->slice, &index));
+        if (CellSlice_init(&inner, r->slice->boc, index) &&
+            CellSlice_remainingRefs(&inner) == 0 && CellSlice_remainingBits(&inner) % 8 == 0 &&
+            CellSlice_remainingBits(&inner) / 8 <= MAX_CELL_INLINE_LEN) {
+            uint8_t data[MAX_CELL_INLINE_LEN];
+            uint8_t len = CellSlice_remainingBits(&inner) / 8;
+            SAFE(CellSlice_loadBuffer(&inner, data, len));
+            SAFE(add_hint_hex(&tx->hints, label, data, len));
+        } else if (N_storage.expert_mode) {
+            CellRef_t ref = r->slice->boc->hashes[index];
+            SAFE(add_hint_hash(&tx->hints, label, ref.hash));
+        }
+        return true;
+    }
 
-            if (N_storage.expert_mode) {
-                add_hint_hash(&tx->hints, "Custom payload", refs[ref_count].hash);
-            }
+    SAFE(buffer_read_u8(r->buf, &type));
+    if (type == 0x00) {
+        BitString_storeBit(&r->bits, 0);
+    } else if (type == 0x01) {
+        SAFE(read_ref(r, &ref));
 
-            BitString_storeBit(&bits, 1);
-            ref_count++;
-        } else {
-            BitString_storeBit(&bits, 0);
+        if (N_storage.expert_mode) {
+            SAFE(add_hint_hash(&tx->hints, label, ref.hash));
         }
 
-        uint8_t fwd_amount_size;
-        uint8_t fwd_amount_buf[MAX_VALUE_BYTES_LEN];
-        SAFE(buffer_read_varuint(&buf, &fwd_amount_size, fwd_amount_buf, MAX_VALUE_BYTES_LEN));
-        BitString_storeCoinsBuf(&bits, fwd_amount_buf, fwd_amount_size);
+        BitString_storeBit(&r->bits, 1);
+    } else if (type == 0x02) {
+        uint8_t len;
+        SAFE(buffer_read_u8(r->buf, &len));
 
-        if (N_storage.expert_mode) {
-            add_hint_amount(&tx->hints,
-                            "Forward amount",
-                            "TON",
-                            fwd_amount_buf,
-                            fwd_amount_size,
-                            EXPONENT_SMALLEST_UNIT);
+        if (len > MAX_CELL_INLINE_LEN) {
+            return false;
         }
 
-        // forward payload
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            SAFE(buffer_read_cell_ref(&buf, &refs[ref_count]));
+        uint8_t data[MAX_CELL_INLINE_LEN];
+        SAFE(buffer_read_buffer(r->buf, data, len));
 
-            if (N_storage.expert_mode) {
-                add_hint_hash(&tx->hints, "Forward payload", refs[ref_count].hash);
-            }
+        // Inline data is displayed even outside of expert mode
+        SAFE(add_hint_hex(&tx->hints, label, data, len));
 
-            BitString_storeBit(&bits, 1);
-            ref_count++;
-        } else {
-            BitString_storeBit(&bits, 0);
-        }
+        BitString_t inner_bits;
+        BitString_init(&inner_bits);
+        BitString_storeBuffer(&inner_bits, data, len);
 
-        CHECK_END();
-
-        // Build cell
-        SAFE(hash_Cell(&bits, refs, ref_count, &cell));
-        hasCell = true;
-
-        // Operation
-        snprintf(
-            tx->title,
-            sizeof(tx->title),
-            tx->hints_type == TRANSACTION_TRANSFER_JETTON ? "Transfer jetton" : "Transfer NFT");
-        snprintf(
-            tx->action,
-            sizeof(tx->action),
-            tx->hints_type == TRANSACTION_TRANSFER_JETTON ? "transfer jetton" : "transfer NFT");
-        snprintf(tx->recipient,
-                 sizeof(tx->recipient),
-                 tx->hints_type == TRANSACTION_TRANSFER_JETTON ? "Jetton wallet" : "NFT Address");
+        SAFE(r->refs_count < CELL_MAX_REFS);
+        SAFE(hash_Cell(&inner_bits, NULL, 0, &r->refs[r->refs_count++]));
+
+        BitString_storeBit(&r->bits, 1);
+    } else {
+        return false;
     }
 
-    if (tx->hints_type == TRANSACTION_BURN_JETTON) {
-        int ref_count = 0;
-        CellRef_t refs[1] = {0};
+    return true;
+}
 
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0x595f07bc, 32);
+static bool read_dns_record(transaction_t* tx, body_reader_t* r) {
+    buffer_t* buf = r->buf;
 
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
-        }
+    // Record encoding is only known from hints
+    SAFE(buf != NULL);
 
-        uint8_t amount_size;
-        uint8_t amount_buf[MAX_VALUE_BYTES_LEN];
-        SAFE(buffer_read_varuint(&buf, &amount_size, amount_buf, MAX_VALUE_BYTES_LEN));
-        BitString_storeCoinsBuf(&bits, amount_buf, amount_size);
+    bool has_value;
+    SAFE(buffer_read_bool(buf, &has_value));
 
-        add_hint_amount(&tx->hints, "Jetton units", "", amount_buf, amount_size, 0);
+    uint8_t type;
+    SAFE(buffer_read_u8(buf, &type));
 
-        address_t response;
-        SAFE(buffer_read_address(&buf, &response));
-        BitString_storeAddress(&bits, response.chain, response.hash);
+    if (type == 0x00) {  // wallet
+        SAFE(add_hint_text(&tx->hints, "Type", "Wallet", 6));
 
-        if (N_storage.expert_mode) {
-            add_hint_address(&tx->hints, "Send excess to", response, false);
-        }
+        BitString_storeBuffer(&r->bits, dns_key_wallet, sizeof(dns_key_wallet));
 
-        // custom payload
-        uint8_t type;
-        SAFE(buffer_read_u8(&buf, &type));
-        if (type == 0x00) {
-            BitString_storeBit(&bits, 0);
-        } else if (type == 0x01) {
-            SAFE(buffer_read_cell_ref(&buf, &refs[ref_count]));
-
-            if (N_storage.expert_mode) {
-                add_hint_hash(&tx->hints, "Custom payload", refs[ref_count].hash);
-            }
+        if (has_value) {
+            address_t address;
+            SAFE(buffer_read_address(buf, &address));
 
-            BitString_storeBit(&bits, 1);
-            ref_count++;
-        } else if (type == 0x02) {
-            uint8_t len;
-            SAFE(buffer_read_u8(&buf, &len));
+            bool has_capabilities;
+            SAFE(buffer_read_bool(buf, &has_capabilities));
 
-            if (len > MAX_CELL_INLINE_LEN) {
-                return false;
+            bool is_wallet = false;
+            if (has_capabilities) {
+                SAFE(buffer_read_bool(buf, &is_wallet));
             }
 
-            uint8_t data[MAX_CELL_INLINE_LEN];
-            SAFE(buffer_read_buffer(&buf, data, len));
-
-            add_hint_hex(&tx->hints, "Custom payload", data, len);
+            SAFE(add_hint_address(&tx->hints, "Wallet address", address, !is_wallet));
 
             BitString_t inner_bits;
             BitString_init(&inner_bits);
-            BitString_storeBuffer(&inner_bits, data, len);
 
-            hash_Cell(&inner_bits, NULL, 0, &refs[ref_count]);
-            ref_count++;
+            BitString_storeUint(&inner_bits, 0x9fd3, 16);
 
-            BitString_storeBit(&bits, 1);
-        } else {
-            return false;
-        }
+            BitString_storeAddress(&inner_bits, address.chain, address.hash);
 
-        CHECK_END();
+            BitString_storeUint(&inner_bits, has_capabilities ? 0x01 : 0x00, 8);
 
-        // Build cell
-        SAFE(hash_Cell(&bits, refs, ref_count, &cell));
-        hasCell = true;
-
-        // Operation
-        snprintf(tx->title, sizeof(tx->title), "Burn jetton");
-        snprintf(tx->action, sizeof(tx->action), "burn jetton");
-        snprintf(tx->recipient, sizeof(tx->recipient), "Jetton wallet");
-    }
-
-    if (tx->hints_type == TRANSACTION_ADD_WHITELIST ||
-        tx->hints_type == TRANSACTION_SINGLE_NOMINATOR_CHANGE_VALIDATOR) {
-        BitString_init(&bits);
-        BitString_storeUint(&bits,
-                            tx->hints_type == TRANSACTION_ADD_WHITELIST ? 0x7258a69b : 0x1001,
-                            32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
-        }
+            if (has_capabilities) {
+                if (is_wallet) {
+                    BitString_storeBit(&inner_bits, 1);
+                    BitString_storeUint(&inner_bits, 0x2177, 16);
+                }
 
-        address_t addr;
-        SAFE(buffer_read_address(&buf, &addr));
-        BitString_storeAddress(&bits, addr.chain, addr.hash);
-
-        add_hint_address(
-            &tx->hints,
-            tx->hints_type == TRANSACTION_ADD_WHITELIST ? "New whitelist" : "New validator",
-            addr,
-            false);
-
-        CHECK_END();
-
-        // Build cell
-        SAFE(hash_Cell(&bits, NULL, 0, &cell));
-        hasCell = true;
-
-        // Operation
-        snprintf(tx->title,
-                 sizeof(tx->title),
-                 tx->hints_type == TRANSACTION_ADD_WHITELIST ? "Add whitelist" : "Edit validator");
-        snprintf(
-            tx->action,
-            sizeof(tx->action),
-            tx->hints_type == TRANSACTION_ADD_WHITELIST ? "add whitelist" : "change validator");
-        snprintf(
-            tx->recipient,
-            sizeof(tx->recipient),
-            tx->hints_type == TRANSACTION_ADD_WHITELIST ? "Vesting wallet" : "Single Nominator");
-    }
+                BitString_storeBit(&inner_bits, 0);
+            }
 
-    if (tx->hints_type == TRANSACTION_SINGLE_NOMINATOR_WITHDRAW) {
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0x1000, 32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
+            SAFE(r->refs_count < CELL_MAX_REFS);
+            SAFE(hash_Cell(&inner_bits, NULL, 0, &r->refs[r->refs_count++]));
         }
+    } else if (type == 0x01) {  // unknown key
+        SAFE(add_hint_text(&tx->hints, "Type", "Unknown", 7));
 
-        uint8_t amount_size;
-        uint8_t amount_buf[MAX_VALUE_BYTES_LEN];
-        SAFE(buffer_read_varuint(&buf, &amount_size, amount_buf, MAX_VALUE_BYTES_LEN));
-        BitString_storeCoinsBuf(&bits, amount_buf, amount_size);
-
-        add_hint_amount(&tx->hints,
-                        "Withdraw amount",
-                        "TON",
-                        amount_buf,
-                        amount_size,
-                        EXPONENT_SMALLEST_UNIT);
+        uint8_t key[32];
+        SAFE(buffer_read_buffer(buf, key, sizeof(key)));
 
-        CHECK_END();
+        BitString_storeBuffer(&r->bits, key, sizeof(key));
 
-        // Build cell
-        SAFE(hash_Cell(&bits, NULL, 0, &cell));
-        hasCell = true;
+        SAFE(add_hint_hash(&tx->hints, "Key", key));
 
-        // Operation
-        snprintf(tx->title, sizeof(tx->title), "Withdraw stake");
-        snprintf(tx->action, sizeof(tx->action), "withdraw from nominator");
-        snprintf(tx->recipient, sizeof(tx->recipient), "Single Nominator");
-    }
-
-    if (tx->hints_type == TRANSACTION_TONSTAKERS_DEPOSIT) {
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0x47d54391, 32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
-        }
+        if (has_value) {
+            CellRef_t ref;
+            SAFE(read_ref(r, &ref));
 
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t app_id;
-            SAFE(buffer_read_u64(&buf, &app_id, BE));
-            BitString_storeUint(&bits, app_id, 64);
+            SAFE(add_hint_hash(&tx->hints, "Value", ref.hash));
         }
-
-        CHECK_END();
-
-        // Build cell
-        SAFE(hash_Cell(&bits, NULL, 0, &cell));
-        hasCell = true;
-
-        // Operation
-        snprintf(tx->title, sizeof(tx->title), "Deposit stake");
-        snprintf(tx->action, sizeof(tx->action), "deposit stake");
-        snprintf(tx->recipient, sizeof(tx->recipient), "Pool");
+    } else {
+        return false;
     }
 
-    if (tx->hints_type == TRANSACTION_JETTON_DAO_VOTE) {
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0x69fb306c, 32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
-        }
-
-        address_t voting_address;
-        SAFE(buffer_read_address(&buf, &voting_address));
-        BitString_storeAddress(&bits, voting_address.chain, voting_address.hash);
-
-        add_hint_address(&tx->hints, "Voting address", voting_address, true);
-
-        uint64_t expiration_date;
-        SAFE(buffer_read_u48(&buf, &expiration_date, BE));
-        BitString_storeUint(&bits, expiration_date, 48);
-
-        add_hint_number(&tx->hints, "Expiration time", expiration_date);
-
-        // vote
-        SAFE(buffer_read_bool(&buf, &tmp));
-        BitString_storeBit(&bits, tmp);
-
-        add_hint_bool(&tx->hints, "Vote", tmp);
-
-        // need_confirmation
-        SAFE(buffer_read_bool(&buf, &tmp));
-        BitString_storeBit(&bits, tmp);
-
-        CHECK_END();
-
-        // Build cell
-        SAFE(hash_Cell(&bits, NULL, 0, &cell));
-        hasCell = true;
-
-        // Operation
-        snprintf(tx->title, sizeof(tx->title), "Vote proposal");
-        snprintf(tx->action, sizeof(tx->action), "vote for proposal");
-        snprintf(tx->recipient, sizeof(tx->recipient), "Jetton wallet");
+    if (!has_value) {
+        SAFE(add_hint_bool(&tx->hints, "Delete value", true));
     }
 
-    if (tx->hints_type == TRANSACTION_CHANGE_DNS_RECORD) {
-        int ref_count = 0;
-        CellRef_t refs[1] = {0};
-
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0x4eb1f0f9, 32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
-        }
+    return true;
+}
 
-        bool has_value;
-        SAFE(buffer_read_bool(&buf, &has_value));
+static bool read_field(transaction_t* tx, body_reader_t* r, const schema_field_t* field) {
+    const char* label = (const char*) PIC(field->label);
+    bool show = label != NULL && (!(field->flags & FIELD_FLAG_EXPERT) || N_storage.expert_mode);
+    bool tmp;
+    uint64_t number;
+    CellRef_t ref;
+
+    switch (field->kind) {
+        case FIELD_QUERY_ID:
+            if (r->slice != NULL) {
+                return CellSlice_loadUint(r->slice, 64, &number);
+            }
+            SAFE(buffer_read_bool(r->buf, &tmp));
+            if (tmp) {
+                return read_uint(r, 8, &number);
+            }
+            BitString_storeUint(&r->bits, 0, 64);
+            return true;
 
-        uint8_t type;
-        SAFE(buffer_read_u8(&buf, &type));
+        case FIELD_UINT:
+            SAFE(read_uint(r, field->size, &number));
+            if (show) {
+                SAFE(add_hint_number(&tx->hints, label, number));
+            }
+            return true;
 
-        if (type == 0x00) {  // wallet
-            add_hint_text(&tx->hints, "Type", "Wallet", 6);
+        case FIELD_OPT_UINT:
+            if (r->slice != NULL) {
+                tmp = CellSlice_remainingBits(r->slice) >= field->size * 8;
+            } else {
+                SAFE(buffer_read_bool(r->buf, &tmp));
+            }
+            if (tmp) {
+                SAFE(read_uint(r, field->size, &number));
+            }
+            return true;
 
-            BitString_storeBuffer(&bits, dns_key_wallet, sizeof(dns_key_wallet));
+        case FIELD_COINS: {
+            uint8_t amount_size;
+            uint8_t amount_buf[MAX_VALUE_BYTES_LEN];
+            if (r->slice != NULL) {
+                SAFE(CellSlice_loadCoins(r->slice, &amount_size, amount_buf, sizeof(amount_buf)));
+            } else {
+                SAFE(buffer_read_varuint(r->buf, &amount_size, amount_buf, sizeof(amount_buf)));
+                BitString_storeCoinsBuf(&r->bits, amount_buf, amount_size);
+            }
+            if (show) {
+                bool ton = field->flags & FIELD_FLAG_TON;
+                SAFE(add_hint_amount(&tx->hints,
+                                     label,
+                                     ton ? "TON" : "",
+                                     amount_buf,
+                                     amount_size,
+                                     ton ? EXPONENT_SMALLEST_UNIT : 0));
+            }
+            return true;
+        }
 
-            if (has_value) {
-                address_t address;
-                SAFE(buffer_read_address(&buf, &address));
+        case FIELD_ADDRESS: {
+            address_t address;
+            if (r->slice != NULL) {
+                SAFE(CellSlice_loadAddress(r->slice, &address));
+            } else {
+                SAFE(buffer_read_address(r->buf, &address));
+                BitString_storeAddress(&r->bits, address.chain, address.hash);
+            }
+            if (show) {
+                SAFE(add_hint_address(&tx->hints,
+                                      label,
+                                      address,
+                                      field->flags & FIELD_FLAG_BOUNCEABLE));
+            }
+            return true;
+        }
 
-                bool has_capabilities;
-                SAFE(buffer_read_bool(&buf, &has_capabilities));
+        case FIELD_BOOL:
+            if (r->slice != NULL) {
+                SAFE(CellSlice_loadBit(r->slice, &tmp));
+            } else {
+                SAFE(buffer_read_bool(r->buf, &tmp));
+                BitString_storeBit(&r->bits, tmp);
+            }
+            if (show) {
+                SAFE(add_hint_bool(&tx->hints, label, tmp));
+            }
+            return true;
+
+        case FIELD_BYTES: {
+            uint8_t data[HASH_LEN];
+            SAFE(field->size == sizeof(data));
+            if (r->slice != NULL) {
+                SAFE(CellSlice_loadBuffer(r->slice, data, sizeof(data)));
+            } else {
+                SAFE(buffer_read_buffer(r->buf, data, sizeof(data)));
+                BitString_storeBuffer(&r->bits, data, sizeof(data));
+            }
+            if (show) {
+                SAFE(add_hint_hash(&tx->hints, label, data));
+            }
+            return true;
+        }
 
-                bool is_wallet = false;
-                if (has_capabilities) {
-                    SAFE(buffer_read_bool(&buf, &is_wallet));
+        case FIELD_MAYBE_REF:
+        case FIELD_EITHER_REF:
+            if (r->slice != NULL) {
+                SAFE(CellSlice_loadBit(r->slice, &tmp));
+                if (!tmp && field->kind == FIELD_EITHER_REF) {
+                    // Inline value takes the rest of the cell, it can only be empty as it
+                    // is not displayed, the message is blind otherwise
+                    SAFE(CellSlice_remainingBits(r->slice) == 0 &&
+                         CellSlice_remainingRefs(r->slice) == 0);
                 }
+            } else {
+                SAFE(buffer_read_bool(r->buf, &tmp));
+                BitString_storeBit(&r->bits, tmp);
+            }
+            if (tmp) {
+                SAFE(read_ref(r, &ref));
+                if (show) {
+                    SAFE(add_hint_hash(&tx->hints, label, ref.hash));
+                }
+            }
+            return true;
 
-                add_hint_address(&tx->hints, "Wallet address", address, !is_wallet);
+        case FIELD_MAYBE_INLINE_REF:
+            return read_inline_ref(tx, r, label);
 
-                BitString_t inner_bits;
-                BitString_init(&inner_bits);
+        case FIELD_TEXT:
+            return read_text(tx, r, label);
 
-                BitString_storeUint(&inner_bits, 0x9fd3, 16);
+        case FIELD_DNS_RECORD:
+            return read_dns_record(tx, r);
 
-                BitString_storeAddress(&inner_bits, address.chain, address.hash);
+        default:
+            return false;
+    }
+}
 
-                BitString_storeUint(&inner_bits, has_capabilities ? 0x01 : 0x00, 8);
+static bool read_body(transaction_t* tx, const message_schema_t* schema, body_reader_t* r) {
+    const schema_field_t* fields = (const schema_field_t*) PIC(schema->fields);
 
-                if (has_capabilities) {
-                    if (is_wallet) {
-                        BitString_storeBit(&inner_bits, 1);
-                        BitString_storeUint(&inner_bits, 0x2177, 16);
-                    }
+    for (uint8_t i = 0; i < schema->fields_count; i++) {
+        SAFE(read_field(tx, r, &fields[i]));
+    }
 
-                    BitString_storeBit(&inner_bits, 0);
-                }
+    return true;
+}
 
-                hash_Cell(&inner_bits, NULL, 0, &refs[ref_count++]);
-            }
-        } else if (type == 0x01) {  // unknown key
-            add_hint_text(&tx->hints, "Type", "Unknown", 7);
+static void set_operation(message_t* msg, const message_schema_t* schema) {
+    msg->title = (const char*) PIC(schema->title);
+    msg->action = (const char*) PIC(schema->action);
+    msg->recipient = (const char*) PIC(schema->recipient);
+}
 
-            uint8_t key[32];
-            SAFE(buffer_read_buffer(&buf, key, sizeof(key)));
+static bool process_payload_cells(transaction_t* tx, message_t* msg) {
+    CellSlice_t slice;
+    uint64_t op;
 
-            BitString_storeBuffer(&bits, key, sizeof(key));
+    SAFE(CellSlice_init(&slice, &tx->payload_boc, 0));
+    SAFE(CellSlice_loadUint(&slice, 32, &op));
 
-            add_hint_hash(&tx->hints, "Key", key);
+    const message_schema_t* schema = schema_from_op(op);
+    SAFE(schema != NULL);
 
-            if (has_value) {
-                SAFE(buffer_read_cell_ref(&buf, &refs[ref_count++]));
+    body_reader_t reader = {.buf = NULL, .slice = &slice};
+    SAFE(read_body(tx, schema, &reader));
+    SAFE(CellSlice_remainingBits(&slice) == 0 && CellSlice_remainingRefs(&slice) == 0);
 
-                add_hint_hash(&tx->hints, "Value", refs[ref_count - 1].hash);
-            }
-        } else {
-            return false;
-        }
+    set_operation(msg, schema);
 
-        if (!has_value) {
-            add_hint_bool(&tx->hints, "Delete value", true);
-        }
+    return true;
+}
 
-        CHECK_END();
+bool process_hints(transaction_t* tx, message_t* msg) {
+    uint8_t hints_start = tx->hints.hints_count;
 
-        // Build cell
-        SAFE(hash_Cell(&bits, refs, ref_count, &cell));
-        hasCell = true;
+    // Default title
+    msg->title = "Transaction";
+    msg->action = "send TON";
+    msg->recipient = "To";
 
-        // Operation
-        snprintf(tx->title, sizeof(tx->title), "Change DNS");
-        snprintf(tx->action, sizeof(tx->action), "change DNS record");
-        snprintf(tx->recipient, sizeof(tx->recipient), "DNS resolver");
+    // No payload
+    if (!msg->has_payload) {
+        msg->title = "Transfer";
+        msg->is_blind = false;
+        return true;
     }
 
-    if (tx->hints_type == TRANSACTION_TOKEN_BRIDGE_PAY_SWAP) {
-        BitString_init(&bits);
-        BitString_storeUint(&bits, 0x8, 32);
-
-        SAFE(buffer_read_bool(&buf, &tmp));
-        if (tmp) {
-            uint64_t query_id;
-            SAFE(buffer_read_u64(&buf, &query_id, BE));
-            BitString_storeUint(&bits, query_id, 64);
-        } else {
-            BitString_storeUint(&bits, 0, 64);
+    // No hints, known messages can still be decoded from payload cells
+    if (!msg->has_hints) {
+        msg->is_blind = !(msg->payload_is_boc && process_payload_cells(tx, msg));
+        if (msg->is_blind) {
+            truncate_hints(&tx->hints, hints_start);
         }
+        return true;
+    }
 
-        uint8_t swap_id[32];
-        SAFE(buffer_read_buffer(&buf, swap_id, sizeof(swap_id)));
-
-        BitString_storeBuffer(&bits, swap_id, sizeof(swap_id));
-
-        add_hint_hash(&tx->hints, "Transfer ID", swap_id);
+    // Default state
+    msg->is_blind = true;
 
-        CHECK_END();
+    const message_schema_t* schema = schema_from_hints_type(msg->hints_type);
+    if (schema == NULL) {
+        return true;
+    }
 
-        // Build cell
-        SAFE(hash_Cell(&bits, NULL, 0, &cell));
-        hasCell = true;
+    buffer_t buf = {.ptr = msg->hints_data, .size = msg->hints_len, .offset = 0};
+    body_reader_t reader = {.buf = &buf, .slice = NULL};
+    BitString_init(&reader.bits);
+    BitString_storeUint(&reader.bits, schema->op, 32);
+    reader.refs_count = 0;
 
-        // Operation
-        snprintf(tx->title, sizeof(tx->title), "Bridge tokens");
-        snprintf(tx->action, sizeof(tx->action), "bridge tokens");
-        snprintf(tx->recipient, sizeof(tx->recipient), "Bridge");
-    }
+    SAFE(read_body(tx, schema, &reader));
+    SAFE(buf.offset == buf.size);
 
     // Check hash
-    if (hasCell) {
-        if (memcmp(cell.hash, tx->payload.hash, HASH_LEN) != 0) {
-            return false;
-        }
-        tx->is_blind = false;
+    CellRef_t cell;
+    SAFE(hash_Cell(&reader.bits, reader.refs, reader.refs_count, &cell));
+    if (memcmp(cell.hash, msg->payload.hash, HASH_LEN) != 0) {
+        return false;
     }
 
+    set_operation(msg, schema);
+    msg->is_blind = false;
+
     return true;
 }
@@ -18,4 +18,20 @@ typedef enum {
     TRANSACTION_TOKEN_BRIDGE_PAY_SWAP = 10,
 } transaction_hint_type_e;
 
-bool process_hints(transaction_t* tx);
+/**
+ * Max hints added for the payload of one message.
+ */
+#define MAX_MESSAGE_HINTS 6
+
+/**
+ * Decode the payload of a message from its hints or cells, appending hints to the transaction.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ * @param[in, out] msg
+ *   Pointer to message of the transaction.
+ *
+ * @return true if success (the message may still be blind), false if hints are invalid.
+ *
+ */
+bool process_hints(transaction_t* tx, message_t* msg);
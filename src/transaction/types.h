@@ -7,6 +7,7 @@
 #include "../constants.h"
 #include "../common/types.h"
 #include "../common/hints.h"
+#include "../common/boc.h"
 
 #define MAX_MEMO_LEN 120
 
@@ -24,16 +25,23 @@ typedef enum {
     STATE_INIT_PARSING_ERROR = -10,
     HINTS_PARSING_ERROR = -11,
     GENERAL_ERROR = -12,
+    MESSAGES_PARSING_ERROR = -13,
 } parser_status_e;
 
+typedef enum {
+    PAYLOAD_NONE = 0,      /// no payload
+    PAYLOAD_CELL_REF = 1,  /// payload hash and depth
+    PAYLOAD_BOC = 2,       /// payload cells as a serialized bag of cells
+} payload_type_e;
+
+/**
+ * Max number of messages in an order, as accepted by wallet contracts v3 and v4.
+ */
+#define MAX_MESSAGES 4
+
 typedef struct {
-    uint8_t tag;  // tag (1 byte)
-    uint32_t subwallet_id;
-    bool include_wallet_op;
-    uint32_t seqno;                          // seqno (4 bytes)
-    uint32_t timeout;                        // timeout (4 bytes)
-    uint8_t value_buf[MAX_VALUE_BYTES_LEN];  // big endian transaction value
-    uint8_t value_len;                       // length of transaction value
+    uint8_t value_buf[MAX_VALUE_BYTES_LEN];  // big endian message value
+    uint8_t value_len;                       // length of message value
     bool bounce;                             // bounce
     uint8_t send_mode;                       // send_mode (1 byte)
     address_t to;                            // receiver
@@ -41,10 +49,127 @@ typedef struct {
     CellRef_t state_init;                    // state_init if exists
     bool has_payload;                        // true if payload exists
     CellRef_t payload;                       // payload if exists
+    bool payload_is_boc;                     // true if payload cells are in transaction payload_boc
     bool has_hints;                          // true if hints exist
     uint32_t hints_type;                     // hints type if exists
     uint16_t hints_len;                      // hints len if exists
     uint8_t* hints_data;                     // hints data if exists
+    bool is_blind;                           // does message require blind signing
+    const char* title;                       // operation title
+    const char* action;                      // operation action
+    const char* recipient;                   // title of receiver
+} message_t;
+
+/**
+ * Structure for a list of send actions, hashed as they are received.
+ */
+typedef struct {
+    uint8_t count;                       // number of actions announced
+    uint8_t received;                    // number of actions hashed
+    uint8_t reserved_hints;              // hints kept for the summary of the order
+    CellRef_t ref;                       // out action list of the actions hashed
+    uint8_t total[MAX_VALUE_BYTES_LEN];  // big endian sum of values of actions
+    bool total_all;                      // an action sends the whole balance
+    uint8_t recipients_hidden;           // recipients which do not fit in hints
+} out_list_t;
+
+/**
+ * Structure for an order of a highload wallet v3.
+ */
+typedef struct {
+    uint32_t query_id;           // shift and bit number (23 bits)
+    uint64_t created_at;         // creation time
+    uint64_t transfer_query_id;  // query_id of internal_transfer
+    message_t transfer;          // internal_transfer message to the wallet itself
+} highload_t;
+
+/**
+ * Max number of extended actions in a wallet v5 request.
+ */
+#define W5_MAX_EXTENDED_ACTIONS 4
+
+typedef enum {
+    W5_ACTION_ADD_EXTENSION = 0x02,          /// action_add_ext
+    W5_ACTION_DELETE_EXTENSION = 0x03,       /// action_delete_ext
+    W5_ACTION_SET_SIGNATURE_ALLOWED = 0x04,  /// action_set_signature_auth_allowed
+} w5_action_e;
+
+typedef struct {
+    uint8_t op;         // w5_action_e
+    address_t address;  // extension if op adds or deletes an extension
+    bool allowed;       // whether signature auth is allowed if op sets it
+} w5_extended_action_t;
+
+/**
+ * Structure for a signed request of a wallet v5.
+ */
+typedef struct {
+    w5_extended_action_t extended[W5_MAX_EXTENDED_ACTIONS];  // extended actions
+    uint8_t extended_count;                                  // number of extended actions
+} w5_t;
+
+/**
+ * Enumeration with parsing state of a transaction request.
+ */
+typedef enum {
+    TX_STATE_HEADER,        /// tag
+    TX_STATE_ORDER,         /// subwallet, seqno, timeout and number of messages
+    TX_STATE_VALUE_LEN,     /// length of message value
+    TX_STATE_MESSAGE,       /// value, receiver, bounce, send mode and state init flag
+    TX_STATE_STATE_INIT,    /// state init cell reference
+    TX_STATE_PAYLOAD_TYPE,  /// payload type
+    TX_STATE_PAYLOAD,       /// payload cell reference
+    TX_STATE_BOC_LEN,       /// length of payload bag of cells
+    TX_STATE_BOC,           /// payload bag of cells, fed to the parser as it is received
+    TX_STATE_HAS_HINTS,     /// hints flag
+    TX_STATE_HINTS_HEADER,  /// hints type and length
+    TX_STATE_HINTS_DATA,    /// hints data, kept for display
+    TX_STATE_MESSAGE_DONE,  /// message received
+    TX_STATE_DONE,          /// all messages received
+} tx_state_e;
+
+/**
+ * Length of the largest fixed size field of a transaction request: message value,
+ * receiver, bounce, send mode and state init flag.
+ */
+#define TX_SCRATCH_LEN (MAX_VALUE_BYTES_LEN + 1 + HASH_LEN + 3)
+
+/**
+ * Structure for incremental parsing of a transaction request, chunks are parsed as
+ * they are received and only the field being read is kept.
+ */
+typedef struct {
+    tx_state_e state;
+    uint8_t scratch[TX_SCRATCH_LEN];  /// accumulator of the fixed size field being read
+    uint8_t scratch_len;              /// bytes in scratch
+    uint8_t field_len;                /// length of the fixed size field being read
+    uint16_t remaining;               /// bytes left in the bag of cells or hints data
+    uint8_t message;                  /// index of the message being read
+} tx_parser_t;
+
+typedef struct {
+    uint8_t tag;  // tag (1 byte)
+    uint32_t subwallet_id;
+    bool include_wallet_op;
+    uint32_t seqno;                          // seqno (4 bytes)
+    uint32_t timeout;                        // timeout (4 bytes)
+    uint8_t messages_count;                  // number of messages
+    union {
+        message_t messages[MAX_MESSAGES];  // messages of the order, tags 0x00 to 0x02
+        // Streamed orders, tags 0x03 and 0x04
+        struct {
+            message_t send_action;  // send action being received
+            out_list_t out_list;    // send actions hashed so far
+            union {
+                highload_t highload;  // highload wallet order if tag is 0x03
+                w5_t w5;              // wallet v5 request if tag is 0x04
+            };
+        };
+    };
+    Boc_t payload_boc;                       // cells of the payload sent as a bag of cells
+    uint8_t hints_data[MAX_HINTS_DATA_LEN];  // hints data and payload cell data of all messages
+    uint16_t hints_data_len;                 // length of hints data
+    tx_parser_t parser;                      // state of the incremental parser
     bool is_blind;                           // does transaction require blind signing
     HintHolder_t hints;
     char title[32];
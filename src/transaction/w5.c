@@ -0,0 +1,202 @@
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <stdio.h>    // snprintf
+#include <string.h>   // memmove
+
+#include "w5.h"
+
+#include "hash.h"
+#include "out_list.h"
+#include "../common/bits.h"
+#include "../common/cell.h"
+#include "../common/hints.h"
+#include "../constants.h"
+
+#define SAFE(RES, CODE) \
+    if (!(RES)) {       \
+        return CODE;    \
+    }
+
+/**
+ * Hints summarizing the request in addition to the ones of the action list:
+ * extended actions and wallet id.
+ */
+#define W5_SUMMARY_HINTS(EXTENDED) (OUT_LIST_SUMMARY_HINTS + (EXTENDED) + 1)
+
+static parser_status_e extended_action_deserialize(buffer_t *buf, w5_extended_action_t *action) {
+    SAFE(buffer_read_u8(buf, &action->op), MESSAGES_PARSING_ERROR);
+
+    switch (action->op) {
+        case W5_ACTION_ADD_EXTENSION:
+        case W5_ACTION_DELETE_EXTENSION:
+            SAFE(buffer_read_address(buf, &action->address), TO_PARSING_ERROR);
+            break;
+        case W5_ACTION_SET_SIGNATURE_ALLOWED:
+            SAFE(buffer_read_bool(buf, &action->allowed), MESSAGES_PARSING_ERROR);
+            break;
+        default:
+            return MESSAGES_PARSING_ERROR;
+    }
+
+    return PARSING_OK;
+}
+
+static void extended_action_store(BitString_t *bits, w5_extended_action_t *action) {
+    // action_add_ext#02 addr:MsgAddressInt = ExtendedAction;
+    // action_delete_ext#03 addr:MsgAddressInt = ExtendedAction;
+    // action_set_signature_auth_allowed#04 allowed:(## 1) = ExtendedAction;
+    BitString_storeUint(bits, action->op, 8);
+    if (action->op == W5_ACTION_SET_SIGNATURE_ALLOWED) {
+        BitString_storeBit(bits, action->allowed ? 1 : 0);
+    } else {
+        BitString_storeAddress(bits, action->address.chain, action->address.hash);
+    }
+}
+
+parser_status_e w5_deserialize_header(buffer_t *buf, transaction_t *tx) {
+    w5_t *w5 = &tx->w5;
+    uint8_t actions_count;
+
+    // tag
+    SAFE(buffer_read_u8(buf, &tx->tag), TAG_PARSING_ERROR);
+    if (tx->tag != W5_TAG) {
+        return TAG_PARSING_ERROR;
+    }
+
+    clear_hints(&tx->hints);
+    tx->messages_count = 0;
+    tx->is_blind = false;
+
+    // Request parameters
+    SAFE(buffer_read_u32(buf, &tx->subwallet_id, BE), GENERAL_ERROR);
+    SAFE(buffer_read_u32(buf, &tx->timeout, BE), TIMEOUT_PARSING_ERROR);
+    SAFE(buffer_read_u32(buf, &tx->seqno, BE), SEQ_PARSING_ERROR);
+
+    // Extended actions
+    SAFE(buffer_read_u8(buf, &w5->extended_count), MESSAGES_PARSING_ERROR);
+    SAFE(w5->extended_count <= W5_MAX_EXTENDED_ACTIONS, MESSAGES_PARSING_ERROR);
+    for (uint8_t i = 0; i < w5->extended_count; i++) {
+        parser_status_e status = extended_action_deserialize(buf, &w5->extended[i]);
+        if (status != PARSING_OK) {
+            return status;
+        }
+    }
+
+    // Send actions, up to W5_MAX_ACTIONS
+    SAFE(buffer_read_u8(buf, &actions_count), MESSAGES_PARSING_ERROR);
+    SAFE(actions_count > 0 || w5->extended_count > 0, MESSAGES_PARSING_ERROR);
+    SAFE(W5_SUMMARY_HINTS(w5->extended_count) <= MAX_HINTS, HINTS_PARSING_ERROR);
+    SAFE(out_list_init(tx, actions_count, W5_SUMMARY_HINTS(w5->extended_count)),
+         GENERAL_ERROR);
+
+    return PARSING_OK;
+}
+
+parser_status_e w5_finalize(transaction_t *tx) {
+    w5_t *w5 = &tx->w5;
+    uint8_t count = tx->hints.hints_count;
+
+    parser_status_e status = out_list_finalize(tx);
+    if (status != PARSING_OK) {
+        return status;
+    }
+
+    // Summary
+    for (uint8_t i = 0; i < w5->extended_count; i++) {
+        w5_extended_action_t *action = &w5->extended[i];
+        switch (action->op) {
+            case W5_ACTION_ADD_EXTENSION:
+                SAFE(add_hint_address(&tx->hints, "Add extension", action->address, true),
+                     HINTS_PARSING_ERROR);
+                break;
+            case W5_ACTION_DELETE_EXTENSION:
+                SAFE(add_hint_address(&tx->hints, "Remove extension", action->address, true),
+                     HINTS_PARSING_ERROR);
+                break;
+            default:
+                if (action->allowed) {
+                    SAFE(add_hint_text(&tx->hints, "Signature auth", "Allowed", 7),
+                         HINTS_PARSING_ERROR);
+                } else {
+                    SAFE(add_hint_text(&tx->hints, "Signature auth", "Disallowed", 10),
+                         HINTS_PARSING_ERROR);
+                }
+                break;
+        }
+    }
+    if (tx->subwallet_id != DEFAULT_W5_WALLET_ID) {
+        SAFE(add_hint_number(&tx->hints, "Wallet ID", (uint64_t) tx->subwallet_id),
+             HINTS_PARSING_ERROR);
+    }
+
+    move_hints_before(&tx->hints, 0, tx->hints.hints_count - count);
+
+    // Operation
+    if (tx->out_list.count == 0) {
+        snprintf(tx->title, sizeof(tx->title), "Update wallet");
+        snprintf(tx->action, sizeof(tx->action), "update wallet");
+    } else if (tx->out_list.count == 1) {
+        snprintf(tx->title, sizeof(tx->title), "Send message");
+        snprintf(tx->action, sizeof(tx->action), "send message");
+    } else {
+        snprintf(tx->title, sizeof(tx->title), "Send %d messages", tx->out_list.count);
+        snprintf(tx->action, sizeof(tx->action), "send %d messages", tx->out_list.count);
+    }
+    snprintf(tx->recipient, sizeof(tx->recipient), "To");
+
+    return PARSING_OK;
+}
+
+bool hash_w5(transaction_ctx_t *ctx) {
+    transaction_t *tx = &ctx->transaction;
+    w5_t *w5 = &tx->w5;
+    BitString_t bits;
+    CellRef_t refs[2];
+    uint8_t refs_count = 0;
+    CellRef_t requestRef;
+
+    // action_list_extended$_ {m:#} {n:#} action:ExtendedAction prev:^(ActionList n m)
+    // = ActionList n (m+1); the first extended action is stored in the request itself and
+    // the following ones in a chain of cells, built from its end
+    CellRef_t extendedRef = {0};
+    for (uint8_t i = w5->extended_count; i > 1; i--) {
+        CellRef_t prev = extendedRef;
+        BitString_init(&bits);
+        extended_action_store(&bits, &w5->extended[i - 1]);
+        if (!hash_Cell(&bits, &prev, i < w5->extended_count ? 1 : 0, &extendedRef)) {
+            return false;
+        }
+    }
+
+    // external_signed#7369676e signed:SignedRequest = ExternalMsgBody;
+    // actions$_ out_actions:(Maybe OutList) has_other_actions:(## 1)
+    // {m:#} {n:#} other_actions:(ActionList n m) = InnerRequest;
+    BitString_init(&bits);
+    BitString_storeUint(&bits, 0x7369676e, 32);        // Opcode
+    BitString_storeUint(&bits, tx->subwallet_id, 32);  // Wallet ID
+    BitString_storeUint(&bits, tx->timeout, 32);       // Valid until
+    BitString_storeUint(&bits, tx->seqno, 32);         // Seqno
+    if (tx->out_list.count > 0) {
+        BitString_storeBit(&bits, 1);
+        refs[refs_count++] = tx->out_list.ref;
+    } else {
+        BitString_storeBit(&bits, 0);
+    }
+    if (w5->extended_count > 0) {
+        BitString_storeBit(&bits, 1);
+        extended_action_store(&bits, &w5->extended[0]);
+        if (w5->extended_count > 1) {
+            refs[refs_count++] = extendedRef;
+        }
+    } else {
+        BitString_storeBit(&bits, 0);
+    }
+    if (!hash_Cell(&bits, refs, refs_count, &requestRef)) {
+        return false;
+    }
+
+    // Result
+    memmove(ctx->m_hash, requestRef.hash, HASH_LEN);
+
+    return true;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+
+#include "types.h"
+#include "../types.h"
+#include "../common/buffer.h"
+
+/**
+ * Tag of transaction requests for wallet v5 signed requests.
+ */
+#define W5_TAG 0x04
+
+/**
+ * Max number of send actions in one wallet v5 request.
+ */
+#define W5_MAX_ACTIONS 255
+
+/**
+ * Deserialize the header of a wallet v5 request, including its extended actions.
+ *
+ * @param[in, out] buf
+ *   Pointer to buffer with serialized header.
+ * @param[out]     tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e w5_deserialize_header(buffer_t *buf, transaction_t *tx);
+
+/**
+ * Check that all actions were received and add the hints summarizing the request.
+ * Send actions are deserialized with out_list_deserialize.
+ *
+ * @param[in, out] tx
+ *   Pointer to transaction structure.
+ *
+ * @return PARSING_OK if success, error status otherwise.
+ *
+ */
+parser_status_e w5_finalize(transaction_t *tx);
+
+/**
+ * Computes the hash of a wallet v5 request for signing
+ *
+ * @param[in, out] ctx
+ *   Pointer to transaction context.
+ *
+ * @return true if success, false otherwise.
+ *
+ */
+bool hash_w5(transaction_ctx_t *ctx);
@@ -4,6 +4,8 @@
 #include <stdint.h>  // uint*_t
 #include <stdbool.h>
 
+#include "cx.h"
+
 #include "constants.h"
 #include "transaction/types.h"
 #include "common/bip32.h"
@@ -21,13 +23,17 @@ typedef enum {
  * Enumeration with expected INS of APDU commands.
  */
 typedef enum {
-    GET_VERSION = 0x03,        /// version of the application
-    GET_APP_NAME = 0x04,       /// name of the application
-    GET_PUBLIC_KEY = 0x05,     /// public key of corresponding BIP32 path
-    SIGN_TX = 0x06,            /// sign transaction with BIP32 path
-    GET_ADDRESS_PROOF = 0x08,  /// get an address proof in TON Connect format
-    SIGN_DATA = 0x09,          /// sign data in TON Connect format
-    GET_APP_SETTINGS = 0x0a,   /// get app settings
+    GET_VERSION = 0x03,            /// version of the application
+    GET_APP_NAME = 0x04,           /// name of the application
+    GET_PUBLIC_KEY = 0x05,         /// public key of corresponding BIP32 path
+    SIGN_TX = 0x06,                /// sign transaction with BIP32 path
+    GET_ADDRESS_PROOF = 0x08,      /// get an address proof in TON Connect format
+    SIGN_DATA = 0x09,              /// sign data in TON Connect format
+    GET_APP_SETTINGS = 0x0a,       /// get app settings
+    GET_PUBLIC_KEYS_BATCH = 0x0b,  /// public keys of consecutive BIP32 paths
+    SIGN_TX_BATCH = 0x0c,          /// sign a batch of transactions approved at once
+    DRY_RUN = 0x0d,                /// parse a request without review, debug builds only
+    GET_PROFILE = 0x0e,            /// time spent in each phase, profiling builds only
 } command_e;
 
 /**
@@ -59,6 +65,9 @@ typedef enum {
     CONFIRM_TRANSACTION,  /// confirm transaction information
     GET_PROOF,            /// confirm address proof information
     CONFIRM_SIGN_DATA,    /// confirm data for signing in TON Connect format
+    CONFIRM_BATCH,        /// confirm a batch of transactions
+    DRY_RUN_TRANSACTION,  /// parse a transaction without review, debug builds only
+    DRY_RUN_SIGN_DATA,    /// parse custom data without review, debug builds only
 } request_type_e;
 
 /**
@@ -66,23 +75,25 @@ typedef enum {
  */
 typedef struct {
     uint8_t raw_public_key[PUBKEY_LEN];
+    uint8_t wallet_version;  /// wallet_version_e of the displayed address
+    uint32_t subwallet_id;   /// subwallet id of the displayed address
 } pubkey_ctx_t;
 
 /**
  * Structure for transaction information context.
  */
 typedef struct {
-    uint8_t raw_tx[MAX_TRANSACTION_LEN];  /// raw transaction serialized
-    size_t raw_tx_len;                    /// length of raw transaction
-    transaction_t transaction;            /// structured transaction
-    uint8_t m_hash[HASH_LEN];             /// message hash digest
-    uint8_t signature[SIG_LEN];           /// transaction signature
+    transaction_t transaction;   /// structured transaction, parsed as chunks are received
+    uint8_t m_hash[HASH_LEN];    /// message hash digest
+    uint8_t signature[SIG_LEN];  /// transaction signature
+    uint16_t chunks_crc;         /// CRC-CCITT of the transaction chunks received
 } transaction_ctx_t;
 
 /**
  * Structure for address proof information context.
  */
 typedef struct {
+    cx_ecfp_private_key_t private_key;  /// key of bip32_path, kept until the review ends
     uint8_t raw_public_key[PUBKEY_LEN];
     int32_t workchain;
     uint8_t domain[MAX_DOMAIN_LEN];
@@ -97,11 +108,26 @@ typedef struct {
     uint64_t timestamp;
     size_t raw_data_len;
     uint8_t raw_data[MAX_DATA_LEN];
+    uint16_t chunks_crc;  /// CRC-CCITT of raw_data
     uint8_t cell_hash[HASH_LEN];
     uint8_t signature[SIG_LEN];
     HintHolder_t hints;
 } sign_data_ctx_t;
 
+/**
+ * Structure for transaction batch information context.
+ */
+typedef struct {
+    transaction_ctx_t order;             /// transaction being received, signed once complete
+    cx_ecfp_private_key_t private_key;   /// key of bip32_path, kept until the batch ends
+    uint8_t raw_public_key[PUBKEY_LEN];  /// public key of bip32_path
+    uint64_t max_amount;                 /// amount approved for all transactions (nanotons)
+    uint64_t sent_amount;                /// amount sent by the transactions signed (nanotons)
+    uint8_t count;                       /// number of transactions approved
+    uint8_t signed_count;                /// number of transactions signed
+    bool order_started;                  /// whether a transaction is being received
+} batch_ctx_t;
+
 /**
  * Structure for global context.
  */
@@ -112,12 +138,18 @@ typedef struct {
         transaction_ctx_t tx_info;  /// transaction context
         proof_ctx_t proof_info;
         sign_data_ctx_t sign_data_info;
+        batch_ctx_t batch_info;
     };
     request_type_e req_type;              /// user request
     uint32_t bip32_path[MAX_BIP32_PATH];  /// BIP32 path
     uint8_t bip32_path_len;               /// length of BIP32 path
 } global_ctx_t;
 
+#ifdef TARGET_NANOS
+// The context takes a large part of the 4 KB of RAM of the Nano S
+_Static_assert(sizeof(global_ctx_t) <= 2048, "Global context is too large for the Nano S");
+#endif
+
 typedef struct {
     bool initialized;
     bool expert_mode;
@@ -16,6 +16,7 @@
  *****************************************************************************/
 
 #include <stdbool.h>  // bool
+#include <string.h>   // explicit_bzero
 
 #include "validate.h"
 #include "../menu.h"
@@ -67,6 +68,7 @@ void ui_action_validate_proof(bool choice) {
             helper_send_response_sig_proof();
         }
     } else {
+        explicit_bzero(&G_context.proof_info.private_key, sizeof(G_context.proof_info.private_key));
         io_send_sw(SW_DENY);
     }
 
@@ -92,3 +94,18 @@ void ui_action_validate_sign_data(bool choice) {
     ui_menu_main();
 #endif
 }
+
+void ui_action_validate_batch(bool choice) {
+    if (choice) {
+        G_context.state = STATE_APPROVED;
+        io_send_sw(SW_OK);
+    } else {
+        explicit_bzero(&G_context, sizeof(G_context));
+        io_send_sw(SW_DENY);
+    }
+
+#ifdef HAVE_BAGL
+    // only for old devices
+    ui_menu_main();
+#endif
+}
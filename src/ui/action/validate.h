@@ -37,3 +37,12 @@ void ui_action_validate_proof(bool choice);
  *
  */
 void ui_action_validate_sign_data(bool choice);
+
+/**
+ * Action for transaction batch validation.
+ *
+ * @param[in] choice
+ *   User choice (either approved or rejectd).
+ *
+ */
+void ui_action_validate_batch(bool choice);
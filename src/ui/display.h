@@ -49,6 +49,15 @@ int ui_display_proof(uint8_t flags);
  */
 int ui_display_sign_data(void);
 
+/**
+ * Display account and number of transactions of a batch on the device and ask
+ * confirmation to sign them.
+ *
+ * @return 0 if success, negative integer otherwise.
+ *
+ */
+int ui_display_batch(uint8_t flags);
+
 /**
  * Display an error when blind signing was requested but is disabled.
  */
@@ -21,6 +21,7 @@
 #include "helpers/display_address.h"
 
 static char g_address[G_ADDRESS_LEN];
+static char g_address_title[G_ADDRESS_TITLE_LEN];
 
 static void confirm_address_rejection(void) {
     // display a status page and go back to main
@@ -53,13 +54,21 @@ int ui_display_address(uint8_t flags) {
     }
 
     // Format address
-    if (!display_address(flags, g_address, sizeof(g_address), NULL, 0)) {
+    if (!display_address(flags,
+                         g_address,
+                         sizeof(g_address),
+                         g_address_title,
+                         sizeof(g_address_title))) {
         return -1;
     }
 
+    // Wallet version and subwallet id are shown only if they are not the defaults
+    bool is_default = G_context.pk_info.wallet_version == WALLET_V4R2 &&
+                      G_context.pk_info.subwallet_id == DEFAULT_SUBWALLET_ID;
+
     nbgl_useCaseReviewStart(&C_ledger_stax_ton_64,
                             "Verify TON address",
-                            NULL,
+                            is_default ? NULL : g_address_title,
                             "Cancel",
                             continue_review,
                             confirm_address_rejection);
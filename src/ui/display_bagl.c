@@ -40,6 +40,7 @@
 #include "../common/encoding.h"
 #include "../common/hints.h"
 #include "helpers/display_address.h"
+#include "helpers/display_batch.h"
 #include "helpers/display_proof.h"
 #include "helpers/display_transaction.h"
 
@@ -50,6 +51,7 @@ static char g_address[G_ADDRESS_LEN];
 static char g_payload[G_PAYLOAD_LEN];
 static char g_domain[MAX_DOMAIN_LEN + 1];
 static char g_address_title[G_ADDRESS_TITLE_LEN];
+static char g_batch_count[4];
 
 const ux_flow_step_t *ux_approval_flow[64];
 
@@ -237,10 +239,14 @@ int ui_display_transaction() {
     if (G_context.tx_info.transaction.is_blind) {
         ux_approval_flow[step++] = &ux_display_blind_signing_warning_step;
     }
-    ux_approval_flow[step++] = &ux_display_address_step;
-    ux_approval_flow[step++] = &ux_display_amount_step;
-    if (G_context.tx_info.transaction.has_payload && G_context.tx_info.transaction.is_blind) {
-        ux_approval_flow[step++] = &ux_display_payload_step;
+    // Messages of larger orders are displayed with hints
+    if (G_context.tx_info.transaction.messages_count == 1) {
+        ux_approval_flow[step++] = &ux_display_address_step;
+        ux_approval_flow[step++] = &ux_display_amount_step;
+        if (G_context.tx_info.transaction.messages[0].has_payload &&
+            G_context.tx_info.transaction.is_blind) {
+            ux_approval_flow[step++] = &ux_display_payload_step;
+        }
     }
     g_hint_holder = &G_context.tx_info.transaction.hints;
     g_hint_offset = -step;
@@ -292,6 +298,70 @@ int ui_display_sign_data() {
     return 0;
 }
 
+// Step with icon and text
+UX_STEP_NOCB(ux_display_review_batch_step,
+             pnn,
+             {
+                 &C_icon_eye,
+                 "Review",
+                 "Batch",
+             });
+// Step with number of transactions of a batch
+UX_STEP_NOCB(ux_display_batch_count_step,
+             bnnn_paging,
+             {
+                 .title = "Transactions",
+                 .text = g_batch_count,
+             });
+// Step with amount approved for all transactions of a batch
+UX_STEP_NOCB(ux_display_batch_amount_step,
+             bnnn_paging,
+             {
+                 .title = "Max total",
+                 .text = g_amount,
+             });
+
+// FLOW to display a batch:
+// #1 screen: eye icon + "Review Batch"
+// #2 screen: blind signing warning
+// #3 screen: number of transactions
+// #4 screen: max total amount
+// #5 screen: display account address
+// #6 screen: approve button
+// #7 screen: reject button
+UX_FLOW(ux_display_batch_flow,
+        &ux_display_review_batch_step,
+        &ux_display_blind_signing_warning_step,
+        &ux_display_batch_count_step,
+        &ux_display_batch_amount_step,
+        &ux_display_address_step,
+        &ux_display_approve_step,
+        &ux_display_reject_step);
+
+int ui_display_batch(uint8_t flags) {
+    if (G_context.req_type != CONFIRM_BATCH || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (!display_batch(flags,
+                       g_address,
+                       sizeof(g_address),
+                       g_batch_count,
+                       sizeof(g_batch_count),
+                       g_amount,
+                       sizeof(g_amount))) {
+        return -1;
+    }
+    snprintf(g_address_title, sizeof(g_address_title), "Account");
+
+    // Launch
+    g_validate_callback = &ui_action_validate_batch;
+    ux_flow_init(0, ux_display_batch_flow, NULL);
+
+    return 0;
+}
+
 #ifdef TARGET_NANOS
 UX_STEP_CB(ux_warning_contract_data_step,
            bnnn_paging,
@@ -0,0 +1,111 @@
+#ifdef HAVE_NBGL
+
+#include <stdbool.h>  // bool
+#include <string.h>   // memset
+
+#include "os.h"
+#include "glyphs.h"
+#include "nbgl_use_case.h"
+
+#include "display.h"
+#include "../constants.h"
+#include "../globals.h"
+#include "../io.h"
+#include "../sw.h"
+#include "action/validate.h"
+#include "menu.h"
+#include "helpers/display_batch.h"
+
+static char g_address[G_ADDRESS_LEN];
+static char g_count[4];
+static char g_amount[G_AMOUNT_LEN];
+static char g_batch_title[64];
+
+static nbgl_layoutTagValue_t pairs[3];
+static nbgl_layoutTagValueList_t pairList;
+
+static nbgl_pageInfoLongPress_t infoLongPress;
+
+static void confirm_batch_rejection(void) {
+    // display a status page and go back to main
+    ui_action_validate_batch(false);
+    nbgl_useCaseStatus("Batch rejected", false, ui_menu_main);
+}
+
+static void ask_rejection_confirmation(void) {
+    // display a choice to confirm/cancel rejection
+    nbgl_useCaseConfirm("Reject batch?",
+                        NULL,
+                        "Yes, reject",
+                        "Go back to batch",
+                        confirm_batch_rejection);
+}
+
+static void on_review_choice(bool confirm) {
+    if (confirm) {
+        // display a status page and go back to main
+        ui_action_validate_batch(true);
+        nbgl_useCaseStatus("BATCH\nAPPROVED", true, ui_menu_main);
+    } else {
+        ask_rejection_confirmation();
+    }
+}
+
+static void start_regular_review(void) {
+    pairs[0].item = "Transactions";
+    pairs[0].value = g_count;
+    pairs[1].item = "Max total";
+    pairs[1].value = g_amount;
+    pairs[2].item = "Account";
+    pairs[2].value = g_address;
+
+    memset(&pairList, 0, sizeof(pairList));
+    pairList.nbPairs = 3;
+    pairList.pairs = pairs;
+
+    snprintf(g_batch_title, sizeof(g_batch_title), "Sign %s transactions\nwithout review", g_count);
+
+    infoLongPress.icon = &C_ledger_stax_ton_64;
+    infoLongPress.text = g_batch_title;
+    infoLongPress.longPressText = "Hold to approve";
+
+    nbgl_useCaseStaticReview(&pairList, &infoLongPress, "Reject batch", on_review_choice);
+}
+
+static void show_blind_warning(void) {
+    nbgl_useCaseReviewStart(&C_round_warning_64px,
+                            "Blind Signing",
+                            "Transactions of this batch\nare signed without being\ndisplayed. "
+                            "It might put\nyour assets at risk.",
+                            "Reject batch",
+                            start_regular_review,
+                            ask_rejection_confirmation);
+}
+
+int ui_display_batch(uint8_t flags) {
+    if (G_context.req_type != CONFIRM_BATCH || G_context.state != STATE_PARSED) {
+        G_context.state = STATE_NONE;
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    if (!display_batch(flags,
+                       g_address,
+                       sizeof(g_address),
+                       g_count,
+                       sizeof(g_count),
+                       g_amount,
+                       sizeof(g_amount))) {
+        return -1;
+    }
+
+    nbgl_useCaseReviewStart(&C_ledger_stax_ton_64,
+                            "Review batch\nof transactions",
+                            NULL,
+                            "Reject batch",
+                            show_blind_warning,
+                            ask_rejection_confirmation);
+
+    return 0;
+}
+
+#endif
@@ -17,7 +17,6 @@
 #include "menu.h"
 #include "hint_buffers_nbgl.h"
 
-static nbgl_layoutTagValue_t pairs[MAX_HINTS];
 static nbgl_layoutTagValueList_t pairList;
 
 static nbgl_pageInfoLongPress_t infoLongPress;
@@ -40,11 +39,8 @@ static void on_review_choice(bool confirm) {
 }
 
 static void start_regular_review(void) {
-    print_hints(&G_context.sign_data_info.hints, pairs);
-
-    pairList.pairs = pairs;
-    pairList.nbPairs = G_context.sign_data_info.hints.hints_count;
-    pairList.smallCaseForValue = false;
+    // Hints are formatted when their page is displayed
+    hint_pairs_init(&pairList, NULL, 0, &G_context.sign_data_info.hints);
 
     infoLongPress.icon = &C_ledger_stax_ton_64;
     infoLongPress.text = "Sign custom data";
@@ -59,6 +55,10 @@ int ui_display_sign_data() {
         return io_send_sw(SW_BAD_STATE);
     }
 
+    if (!hint_pairs_fit(&G_context.sign_data_info.hints)) {
+        return io_send_sw(SW_DISPLAY_HINTS_FAIL);
+    }
+
     // Start review
     nbgl_useCaseReviewStart(&C_ledger_stax_ton_64,
                             "Sign custom data",
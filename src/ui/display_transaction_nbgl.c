@@ -31,7 +31,8 @@ static char g_address_title[G_ADDRESS_TITLE_LEN];
 
 static char g_transaction_title[64];
 
-static nbgl_layoutTagValue_t pairs[3 + MAX_HINTS];
+// Pairs displayed before the hints
+static nbgl_layoutTagValue_t pairs[4];
 static nbgl_layoutTagValueList_t pairList;
 
 static nbgl_pageInfoLongPress_t infoLongPress;
@@ -69,25 +70,26 @@ static void start_regular_review(void) {
     pairs[pairIndex].value = g_operation;
     pairIndex++;
 
-    pairs[pairIndex].item = "Amount";
-    pairs[pairIndex].value = g_amount;
-    pairIndex++;
-
-    pairs[pairIndex].item = g_address_title;
-    pairs[pairIndex].value = g_address;
-    pairIndex++;
+    // Messages of larger orders are displayed with hints
+    if (G_context.tx_info.transaction.messages_count == 1) {
+        pairs[pairIndex].item = "Amount";
+        pairs[pairIndex].value = g_amount;
+        pairIndex++;
 
-    if (G_context.tx_info.transaction.has_payload && G_context.tx_info.transaction.is_blind) {
-        pairs[pairIndex].item = "Payload";
-        pairs[pairIndex].value = g_payload;
+        pairs[pairIndex].item = g_address_title;
+        pairs[pairIndex].value = g_address;
         pairIndex++;
-    }
 
-    print_hints(&G_context.tx_info.transaction.hints, &pairs[pairIndex]);
+        if (G_context.tx_info.transaction.messages[0].has_payload &&
+            G_context.tx_info.transaction.is_blind) {
+            pairs[pairIndex].item = "Payload";
+            pairs[pairIndex].value = g_payload;
+            pairIndex++;
+        }
+    }
 
-    pairList.pairs = pairs;
-    pairList.nbPairs = pairIndex + G_context.tx_info.transaction.hints.hints_count;
-    pairList.smallCaseForValue = false;
+    // Hints are formatted when their page is displayed
+    hint_pairs_init(&pairList, pairs, pairIndex, &G_context.tx_info.transaction.hints);
 
     snprintf(g_transaction_title,
              sizeof(g_transaction_title),
@@ -139,6 +141,10 @@ int ui_display_transaction() {
         return -1;
     }
 
+    if (!hint_pairs_fit(&G_context.tx_info.transaction.hints)) {
+        return io_send_sw(SW_DISPLAY_HINTS_FAIL);
+    }
+
     snprintf(g_transaction_title,
              sizeof(g_transaction_title),
              "Review transaction\nto %s",
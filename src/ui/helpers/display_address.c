@@ -7,10 +7,10 @@
 
 #include "../../transaction/types.h"
 #include "../../address.h"
+#include "../../common/format_address.h"
 #include "../../globals.h"
 #include "../../io.h"
 #include "../../sw.h"
-#include "../../common/base64.h"
 #include "../../apdu/params.h"
 
 bool display_address(uint8_t flags,
@@ -19,7 +19,6 @@ bool display_address(uint8_t flags,
                      char *g_address_title,
                      size_t g_address_title_len) {
     memset(g_address, 0, g_address_len);
-    uint8_t address[ADDRESS_LEN] = {0};
     bool testnet = false;
     uint8_t chain = 0;
     if (flags & P2_ADDR_FLAG_TESTNET) {
@@ -28,18 +27,28 @@ bool display_address(uint8_t flags,
     if (flags & P2_ADDR_FLAG_MASTERCHAIN) {
         chain = 0xff;
     }
-    if (!address_from_pubkey(G_context.pk_info.raw_public_key,
-                             chain,
-                             false,
-                             testnet,
-                             address,
-                             sizeof(address))) {
+    uint8_t hash[HASH_LEN] = {0};
+    wallet_version_e version = (wallet_version_e) G_context.pk_info.wallet_version;
+    uint32_t subwallet_id = G_context.pk_info.subwallet_id;
+    if (!wallet_to_hash(version, subwallet_id, G_context.pk_info.raw_public_key, hash) ||
+        !address_to_friendly_base64(chain, hash, false, testnet, g_address, g_address_len)) {
         io_send_sw(SW_DISPLAY_ADDRESS_FAIL);
         return false;
     }
-    base64_encode(address, sizeof(address), g_address, g_address_len);
     if (g_address_title != NULL) {
-        snprintf(g_address_title, g_address_title_len, "Address");
+        // Wallet version and subwallet id are only displayed if they are not the defaults
+        bool default_subwallet = subwallet_id == wallet_default_subwallet_id(version);
+        if (version == WALLET_V4R2 && default_subwallet) {
+            snprintf(g_address_title, g_address_title_len, "Address");
+        } else if (default_subwallet) {
+            snprintf(g_address_title, g_address_title_len, "Address (%s)", wallet_name(version));
+        } else {
+            snprintf(g_address_title,
+                     g_address_title_len,
+                     "Address (%s, %u)",
+                     wallet_name(version),
+                     (unsigned) subwallet_id);
+        }
     }
     return true;
 }
@@ -0,0 +1,58 @@
+#include <string.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "display_batch.h"
+
+#include "../../transaction/types.h"
+#include "../../address.h"
+#include "../../globals.h"
+#include "../../io.h"
+#include "../../sw.h"
+#include "../../common/format_address.h"
+#include "../../common/format_bigint.h"
+#include "../../common/write.h"
+#include "../../constants.h"
+#include "../../apdu/params.h"
+
+bool display_batch(uint8_t flags,
+                   char *g_address,
+                   size_t g_address_len,
+                   char *g_count,
+                   size_t g_count_len,
+                   char *g_amount,
+                   size_t g_amount_len) {
+    memset(g_address, 0, g_address_len);
+    uint8_t hash[HASH_LEN] = {0};
+    bool testnet = false;
+    uint8_t chain = 0;
+    if (flags & P2_ADDR_FLAG_TESTNET) {
+        testnet = true;
+    }
+    if (flags & P2_ADDR_FLAG_MASTERCHAIN) {
+        chain = 0xff;
+    }
+    if (!pubkey_to_hash(G_context.batch_info.raw_public_key, hash, sizeof(hash)) ||
+        !address_to_friendly_base64(chain, hash, false, testnet, g_address, g_address_len)) {
+        io_send_sw(SW_DISPLAY_ADDRESS_FAIL);
+        return false;
+    }
+
+    snprintf(g_count, g_count_len, "%d", G_context.batch_info.count);
+
+    uint8_t max_amount[8];
+    write_u64_be(max_amount, 0, G_context.batch_info.max_amount);
+    memset(g_amount, 0, g_amount_len);
+    if (!amountToString(max_amount,
+                        sizeof(max_amount),
+                        EXPONENT_SMALLEST_UNIT,
+                        "TON",
+                        g_amount,
+                        g_amount_len)) {
+        io_send_sw(SW_DISPLAY_AMOUNT_FAIL);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+bool display_batch(uint8_t flags,
+                   char *g_address,
+                   size_t g_address_len,
+                   char *g_count,
+                   size_t g_count_len,
+                   char *g_amount,
+                   size_t g_amount_len);
@@ -11,7 +11,6 @@
 #include "../../globals.h"
 #include "../../io.h"
 #include "../../sw.h"
-#include "../../common/base64.h"
 #include "../../apdu/params.h"
 
 bool display_proof(uint8_t flags,
@@ -22,21 +21,19 @@ bool display_proof(uint8_t flags,
                    char *g_address_title,
                    size_t g_address_title_len) {
     memset(g_address, 0, g_address_len);
-    uint8_t address[ADDRESS_LEN] = {0};
     bool testnet = false;
     if (flags & P2_ADDR_FLAG_TESTNET) {
         testnet = true;
     }
-    if (!address_to_friendly(G_context.proof_info.workchain == -1 ? 0xff : 0,
-                             G_context.proof_info.address_hash,
-                             false,
-                             testnet,
-                             address,
-                             sizeof(address))) {
+    if (!address_to_friendly_base64(G_context.proof_info.workchain == -1 ? 0xff : 0,
+                                    G_context.proof_info.address_hash,
+                                    false,
+                                    testnet,
+                                    g_address,
+                                    g_address_len)) {
         io_send_sw(SW_DISPLAY_ADDRESS_FAIL);
         return false;
     }
-    base64_encode(address, sizeof(address), g_address, g_address_len);
 
     if (check_ascii(G_context.proof_info.domain, G_context.proof_info.domain_len)) {
         memmove(g_domain, G_context.proof_info.domain, G_context.proof_info.domain_len);
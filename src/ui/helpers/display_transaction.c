@@ -24,17 +24,20 @@ bool display_transaction(char *g_operation,
                          size_t g_payload_len,
                          char *g_address_title,
                          size_t g_address_title_len) {
+    // Fields of the first message, messages of larger orders are displayed with hints
+    const message_t *msg = &G_context.tx_info.transaction.messages[0];
+
     // Operation
     memset(g_operation, 0, g_operation_len);
     snprintf(g_operation, g_operation_len, "%s", G_context.tx_info.transaction.title);
 
     // Amount
     memset(g_amount, 0, g_amount_len);
-    if ((G_context.tx_info.transaction.send_mode & 128) != 0) {
+    if ((msg->send_mode & 128) != 0) {
         snprintf(g_amount, g_amount_len, "ALL YOUR TONs");
     } else {
-        if (!amountToString(G_context.tx_info.transaction.value_buf,
-                            G_context.tx_info.transaction.value_len,
+        if (!amountToString(msg->value_buf,
+                            msg->value_len,
                             EXPONENT_SMALLEST_UNIT,
                             "TON",
                             g_amount,
@@ -45,26 +48,21 @@ bool display_transaction(char *g_operation,
     }
 
     // Address
-    uint8_t address[ADDRESS_LEN] = {0};
-    if (!address_to_friendly(G_context.tx_info.transaction.to.chain,
-                             G_context.tx_info.transaction.to.hash,
-                             G_context.tx_info.transaction.bounce,
-                             false,
-                             address,
-                             sizeof(address))) {
+    memset(g_address, 0, g_address_len);
+    if (!address_to_friendly_base64(msg->to.chain,
+                                    msg->to.hash,
+                                    msg->bounce,
+                                    false,
+                                    g_address,
+                                    g_address_len)) {
         io_send_sw(SW_DISPLAY_ADDRESS_FAIL);
         return false;
     }
-    memset(g_address, 0, g_address_len);
-    base64_encode(address, sizeof(address), g_address, g_address_len);
 
     // Payload
     memset(g_payload, 0, g_payload_len);
-    if (G_context.tx_info.transaction.has_payload) {
-        base64_encode(G_context.tx_info.transaction.payload.hash,
-                      HASH_LEN,
-                      g_payload,
-                      g_payload_len);
+    if (msg->has_payload) {
+        base64_encode(msg->payload.hash, HASH_LEN, g_payload, g_payload_len);
     } else {
         snprintf(g_payload, g_payload_len, "Nothing");
     }
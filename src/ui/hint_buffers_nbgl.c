@@ -12,31 +12,119 @@
 #include "../constants.h"
 #include "../common/hints.h"
 
-char g_hint_title_buffer[32 * MAX_HINTS];
-char g_hint_buffer[64 * MAX_HINTS];
-
-void print_hints(HintHolder_t *hints, nbgl_layoutTagValue_t *pairs) {
-    size_t hint_buffer_offset = 0;
-    size_t hint_title_buffer_offset = 0;
-    int pairIndex = 0;
-    for (uint16_t i = 0; i < hints->hints_count; i++) {
-        print_hint(hints,
-                   i,
-                   &g_hint_title_buffer[hint_title_buffer_offset],
-                   sizeof(g_hint_title_buffer) - hint_title_buffer_offset,
-                   &g_hint_buffer[hint_buffer_offset],
-                   sizeof(g_hint_buffer) - hint_buffer_offset);
-        pairs[pairIndex].item = &g_hint_title_buffer[hint_title_buffer_offset];
-        pairs[pairIndex].value = &g_hint_buffer[hint_buffer_offset];
-        pairIndex++;
-        hint_title_buffer_offset +=
-            strnlen(&g_hint_title_buffer[hint_title_buffer_offset],
-                    sizeof(g_hint_title_buffer) - hint_title_buffer_offset) +
-            1;
-        hint_buffer_offset += strnlen(&g_hint_buffer[hint_buffer_offset],
-                                      sizeof(g_hint_buffer) - hint_buffer_offset) +
-                              1;
+/**
+ * Number of formatted hints kept: NBGL measures a page by asking for its pairs until one
+ * does not fit, then builds the page with the same pairs, so it uses one page of pairs
+ * plus the one after it.
+ */
+#define HINT_CACHE_SLOTS (HINT_PAGE_MAX_PAIRS + 1)
+
+#define HINT_PAIR_TITLE_LEN 32
+
+/**
+ * Values of a slot fit comments, domains, addresses and amounts. Only the plaintext of
+ * custom data may be longer, it is formatted in a buffer shared by all slots, which
+ * hint_pairs_fit checks is never needed twice by the pairs in use.
+ */
+#define HINT_PAIR_VALUE_LEN      128
+#define HINT_PAIR_LONG_VALUE_LEN 256
+
+typedef struct {
+    int16_t index;  /// index of the hint formatted in this slot, -1 if none
+    char title[HINT_PAIR_TITLE_LEN];
+    char value[HINT_PAIR_VALUE_LEN];
+    nbgl_layoutTagValue_t pair;
+} hint_slot_t;
+
+static hint_slot_t g_hint_slots[HINT_CACHE_SLOTS];
+static char g_hint_long_value[HINT_PAIR_LONG_VALUE_LEN];
+static hint_slot_t *g_hint_long_value_slot;  /// slot displaying the long value, if any
+static HintHolder_t *g_hints;
+static const nbgl_layoutTagValue_t *g_fixed_pairs;
+static uint8_t g_fixed_count;
+
+/**
+ * Whether a hint does not fit in the value of a slot.
+ */
+static bool is_long_value(const HintHolder_t *hints, uint8_t index) {
+    Hint_t hint;
+
+    return get_hint(hints, index, &hint) && hint.kind == SummaryItemString &&
+           hint.string.length >= HINT_PAIR_VALUE_LEN;
+}
+
+static nbgl_layoutTagValue_t *get_pair(uint8_t index) {
+    if (index < g_fixed_count) {
+        return (nbgl_layoutTagValue_t *) &g_fixed_pairs[index];
+    }
+
+    // Pairs of a page and the one after have consecutive indexes, they never share a slot
+    uint8_t hint = index - g_fixed_count;
+    hint_slot_t *slot = &g_hint_slots[hint % HINT_CACHE_SLOTS];
+    if (slot->index != hint) {
+        char *value = slot->value;
+        size_t value_len = sizeof(slot->value);
+        if (is_long_value(g_hints, hint)) {
+            // The previous long value is no longer in use, its slot is formatted again if
+            // it is asked for
+            if (g_hint_long_value_slot != NULL && g_hint_long_value_slot != slot) {
+                g_hint_long_value_slot->index = -1;
+            }
+            g_hint_long_value_slot = slot;
+            value = g_hint_long_value;
+            value_len = sizeof(g_hint_long_value);
+        } else if (g_hint_long_value_slot == slot) {
+            g_hint_long_value_slot = NULL;
+        }
+
+        print_hint(g_hints, hint, slot->title, sizeof(slot->title), value, value_len);
+        slot->index = hint;
+        slot->pair.item = slot->title;
+        slot->pair.value = value;
     }
+
+    return &slot->pair;
+}
+
+bool hint_pairs_fit(const HintHolder_t *hints) {
+    int16_t last_long = -HINT_CACHE_SLOTS;
+
+    for (uint8_t i = 0; i < hints->hints_count; i++) {
+        Hint_t hint;
+        if (!get_hint(hints, i, &hint)) {
+            return false;
+        }
+        if (hint.kind == SummaryItemString && hint.string.length >= HINT_PAIR_VALUE_LEN) {
+            // Signed content is never truncated
+            if (hint.string.length >= HINT_PAIR_LONG_VALUE_LEN ||
+                i - last_long < HINT_CACHE_SLOTS) {
+                return false;
+            }
+            last_long = i;
+        }
+    }
+
+    return true;
+}
+
+void hint_pairs_init(nbgl_layoutTagValueList_t *list,
+                     const nbgl_layoutTagValue_t *fixed,
+                     uint8_t fixed_count,
+                     HintHolder_t *hints) {
+    for (size_t i = 0; i < HINT_CACHE_SLOTS; i++) {
+        g_hint_slots[i].index = -1;
+    }
+    g_hint_long_value_slot = NULL;
+    g_hints = hints;
+    g_fixed_pairs = fixed;
+    g_fixed_count = fixed_count;
+
+    memset(list, 0, sizeof(*list));
+    list->pairs = NULL;
+    list->callback = get_pair;
+    list->startIndex = 0;
+    list->nbPairs = fixed_count + hints->hints_count;
+    list->smallCaseForValue = false;
 }
 
 #endif
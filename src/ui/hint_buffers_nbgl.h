@@ -1,13 +1,44 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "nbgl_use_case.h"
 
 #include "../common/hints.h"
-#include "../constants.h"
 
-extern char g_hint_title_buffer[32 * MAX_HINTS];
-extern char g_hint_buffer[64 * MAX_HINTS];
+/**
+ * Max number of tag/value pairs displayed on one review page.
+ */
+#define HINT_PAGE_MAX_PAIRS 4
 
-void print_hints(HintHolder_t *hints, nbgl_layoutTagValue_t *pairs);
+/**
+ * Check that hints can be displayed whole: one page of pairs and the one after it may
+ * hold only one value longer than 127 characters, and no value may be longer than 255.
+ *
+ * @param[in] hints
+ *   Pointer to hints.
+ *
+ * @return true if hints fit, false otherwise.
+ *
+ */
+bool hint_pairs_fit(const HintHolder_t *hints);
+
+/**
+ * Set up a paged list of tag/value pairs made of fixed pairs followed by hints. Hints are
+ * only formatted when NBGL asks for the pairs of the page being drawn or measured.
+ *
+ * @param[out] list
+ *   Pointer to list given to the review use case.
+ * @param[in]  fixed
+ *   Pointer to pairs displayed before the hints, must outlive the review.
+ * @param[in]  fixed_count
+ *   Number of fixed pairs.
+ * @param[in]  hints
+ *   Pointer to hints, must outlive the review.
+ *
+ */
+void hint_pairs_init(nbgl_layoutTagValueList_t *list,
+                     const nbgl_layoutTagValue_t *fixed,
+                     uint8_t fixed_count,
+                     HintHolder_t *hints);
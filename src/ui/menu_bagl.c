@@ -22,6 +22,7 @@
 #include "glyphs.h"
 
 #include "../globals.h"
+#include "../common/pubkey_cache.h"
 #include "menu.h"
 
 static const char* settings_submenu_getter(unsigned int idx);
@@ -114,6 +115,11 @@ void ui_menu_settings() {
     ux_menulist_init(0, settings_submenu_getter, settings_submenu_selector);
 }
 
+static void app_quit(void) {
+    pubkey_cache_clear();
+    os_sched_exit(-1);
+}
+
 UX_STEP_NOCB(ux_menu_ready_step, pb, {&C_ton_logo, "TON is ready"});
 UX_STEP_CB(ux_menu_settings_step,
            pb,
@@ -123,7 +129,7 @@ UX_STEP_CB(ux_menu_settings_step,
                "Settings",
            });
 UX_STEP_CB(ux_menu_about_step, pb, ui_menu_about(), {&C_icon_certificate, "About"});
-UX_STEP_VALID(ux_menu_exit_step, pb, os_sched_exit(-1), {&C_icon_dashboard_x, "Quit"});
+UX_STEP_VALID(ux_menu_exit_step, pb, app_quit(), {&C_icon_dashboard_x, "Quit"});
 
 // FLOW for the main menu:
 // #1 screen: ready
@@ -22,10 +22,12 @@
 #include "nbgl_use_case.h"
 
 #include "../globals.h"
+#include "../common/pubkey_cache.h"
 #include "menu.h"
 
 void app_quit(void) {
     // exit app here
+    pubkey_cache_clear();
     os_sched_exit(-1);
 }
 
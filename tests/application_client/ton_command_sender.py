@@ -1,3 +1,4 @@
+from binascii import crc_hqx
 from enum import IntEnum, IntFlag
 from typing import Generator, Optional
 from contextlib import contextmanager
@@ -19,6 +20,26 @@ class P1(IntEnum):
 
     P1_NON_CONFIRM = 0x00
 
+    P1_ADDRESS_HASHES = 0x02
+
+    P1_BATCH_PUBKEYS = 0x00
+
+    P1_BATCH_ADDRESS_HASHES = 0x01
+
+    P1_BATCH_REVIEW = 0x00
+
+    P1_BATCH_TRANSACTION = 0x01
+
+    P1_DRY_RUN_TRANSACTION = 0x00
+
+    P1_DRY_RUN_SIGN_DATA = 0x01
+
+    P1_DRY_RUN_HINT = 0x02
+
+    P1_PROFILE_READ = 0x00
+
+    P1_PROFILE_RESET = 0x01
+
 class P2(IntFlag):
     P2_NONE = 0x00
 
@@ -34,6 +55,10 @@ class InsType(IntEnum):
     GET_ADDRESS_PROOF = 0x08
     SIGN_DATA         = 0x09
     GET_APP_SETTINGS  = 0x0A
+    GET_PUBLIC_KEYS_BATCH = 0x0B
+    SIGN_TX_BATCH     = 0x0C
+    DRY_RUN           = 0x0D
+    GET_PROFILE       = 0x0E
 
 class Errors(IntEnum):
     SW_DENY                    = 0x6985
@@ -48,9 +73,11 @@ class Errors(IntEnum):
     SW_TX_PARSING_FAIL         = 0xB010
     SW_WRONG_SIGN_DATA_LENGTH  = 0xB005
     SW_SIGN_DATA_PARSING_FAIL  = 0xB011
+    SW_DISPLAY_HINTS_FAIL      = 0xB006
     SW_BAD_STATE               = 0xB007
     SW_SIGNATURE_FAIL          = 0xB008
     SW_REQUEST_TOO_LONG        = 0xB00B
+    SW_BATCH_AMOUNT_EXCEEDED   = 0xB00C
     SW_BAD_BIP32_PATH          = 0XB0BD
     SW_BLIND_SIGNING_DISABLED  = 0xBD00
 
@@ -58,6 +85,7 @@ class AddressDisplayFlags(IntFlag):
     NONE = 0
     TESTNET = 1
     MASTERCHAIN = 2
+    WALLET_SPECIFIERS = 4
 
 
 class BoilerplateCommandSender:
@@ -97,6 +125,27 @@ class BoilerplateCommandSender:
                                      data=pack_derivation_path(path))
 
 
+    def get_address_hashes(self, path: str, subwallet_id: Optional[int] = None) -> RAPDU:
+        data = pack_derivation_path(path)
+        flags = AddressDisplayFlags.NONE
+        if subwallet_id is not None:
+            data += subwallet_id.to_bytes(4, byteorder="big") + b"\x00"
+            flags |= AddressDisplayFlags.WALLET_SPECIFIERS
+        return self.backend.exchange(cla=CLA,
+                                     ins=InsType.GET_PUBLIC_KEY,
+                                     p1=P1.P1_ADDRESS_HASHES,
+                                     p2=flags,
+                                     data=data)
+
+
+    def get_public_keys_batch(self, path: str, start: int, count: int, address_hashes: bool = False) -> RAPDU:
+        return self.backend.exchange(cla=CLA,
+                                     ins=InsType.GET_PUBLIC_KEYS_BATCH,
+                                     p1=P1.P1_BATCH_ADDRESS_HASHES if address_hashes else P1.P1_BATCH_PUBKEYS,
+                                     p2=P2.P2_NONE,
+                                     data=pack_derivation_path(path) + start.to_bytes(4, byteorder="big") + count.to_bytes(1, byteorder="big"))
+
+
     def get_app_settings(self) -> RAPDU:
         return self.backend.exchange(cla=CLA,
                                      ins=InsType.GET_APP_SETTINGS,
@@ -141,19 +190,34 @@ class BoilerplateCommandSender:
 
     @contextmanager
     def sign_tx(self, path: str, transaction: bytes) -> Generator[None, None, None]:
+        # Small transactions are sent along with the path
+        data = pack_derivation_path(path) + transaction
+        if len(data) <= MAX_APDU_LEN:
+            with self.backend.exchange_async(cla=CLA,
+                                             ins=InsType.SIGN_TX,
+                                             p1=P1.P1_NONE,
+                                             p2=P2.P2_FIRST,
+                                             data=data) as response:
+                yield response
+            return
+
         self.backend.exchange(cla=CLA,
                               ins=InsType.SIGN_TX,
                               p1=P1.P1_NONE,
                               p2=(P2.P2_FIRST | P2.P2_MORE),
                               data=pack_derivation_path(path))
         messages = split_message(transaction, MAX_APDU_LEN)
+        crc = 0
 
+        # Chunks are acknowledged with the CRC of the chunks received
         for msg in messages[:-1]:
-            self.backend.exchange(cla=CLA,
-                                  ins=InsType.SIGN_TX,
-                                  p1=P1.P1_NONE,
-                                  p2=P2.P2_MORE,
-                                  data=msg)
+            rapdu = self.backend.exchange(cla=CLA,
+                                          ins=InsType.SIGN_TX,
+                                          p1=P1.P1_NONE,
+                                          p2=P2.P2_MORE,
+                                          data=msg)
+            crc = crc_hqx(msg, crc)
+            assert rapdu.data == crc.to_bytes(2, byteorder="big")
 
         with self.backend.exchange_async(cla=CLA,
                                          ins=InsType.SIGN_TX,
@@ -162,6 +226,36 @@ class BoilerplateCommandSender:
                                          data=messages[-1]) as response:
             yield response
 
+    @contextmanager
+    def sign_tx_batch_review(self, path: str, count: int, max_amount: int, flags: AddressDisplayFlags = AddressDisplayFlags.NONE) -> Generator[None, None, None]:
+        with self.backend.exchange_async(cla=CLA,
+                                         ins=InsType.SIGN_TX_BATCH,
+                                         p1=P1.P1_BATCH_REVIEW,
+                                         p2=flags,
+                                         data=pack_derivation_path(path) + count.to_bytes(1, byteorder="big") + max_amount.to_bytes(8, byteorder="big")) as response:
+            yield response
+
+    def sign_tx_batch_transaction(self, transaction: bytes) -> RAPDU:
+        messages = split_message(transaction, MAX_APDU_LEN)
+        first = P2.P2_FIRST
+        crc = 0
+
+        for msg in messages[:-1]:
+            rapdu = self.backend.exchange(cla=CLA,
+                                          ins=InsType.SIGN_TX_BATCH,
+                                          p1=P1.P1_BATCH_TRANSACTION,
+                                          p2=first | P2.P2_MORE,
+                                          data=msg)
+            first = P2.P2_NONE
+            crc = crc_hqx(msg, crc)
+            assert rapdu.data == crc.to_bytes(2, byteorder="big")
+
+        return self.backend.exchange(cla=CLA,
+                                     ins=InsType.SIGN_TX_BATCH,
+                                     p1=P1.P1_BATCH_TRANSACTION,
+                                     p2=first,
+                                     data=messages[-1])
+
     @contextmanager
     def sign_data(self, path: str, data: bytes) -> Generator[None, None, None]:
         self.backend.exchange(cla=CLA,
@@ -170,13 +264,16 @@ class BoilerplateCommandSender:
                               p2=(P2.P2_FIRST | P2.P2_MORE),
                               data=pack_derivation_path(path))
         messages = split_message(data, MAX_APDU_LEN)
+        crc = 0
 
         for msg in messages[:-1]:
-            self.backend.exchange(cla=CLA,
-                                  ins=InsType.SIGN_DATA,
-                                  p1=P1.P1_NONE,
-                                  p2=P2.P2_MORE,
-                                  data=msg)
+            rapdu = self.backend.exchange(cla=CLA,
+                                          ins=InsType.SIGN_DATA,
+                                          p1=P1.P1_NONE,
+                                          p2=P2.P2_MORE,
+                                          data=msg)
+            crc = crc_hqx(msg, crc)
+            assert rapdu.data == crc.to_bytes(2, byteorder="big")
 
         with self.backend.exchange_async(cla=CLA,
                                          ins=InsType.SIGN_DATA,
@@ -185,5 +282,40 @@ class BoilerplateCommandSender:
                                          data=messages[-1]) as response:
             yield response
 
+    # Only supported by debug builds
+    def dry_run(self, request: bytes, sign_data: bool = False) -> RAPDU:
+        p1 = P1.P1_DRY_RUN_SIGN_DATA if sign_data else P1.P1_DRY_RUN_TRANSACTION
+        messages = split_message(request, MAX_APDU_LEN)
+        first = P2.P2_FIRST
+
+        for msg in messages[:-1]:
+            self.backend.exchange(cla=CLA,
+                                  ins=InsType.DRY_RUN,
+                                  p1=p1,
+                                  p2=first | P2.P2_MORE,
+                                  data=msg)
+            first = P2.P2_NONE
+
+        return self.backend.exchange(cla=CLA,
+                                     ins=InsType.DRY_RUN,
+                                     p1=p1,
+                                     p2=first,
+                                     data=messages[-1])
+
+    def dry_run_hint(self, index: int) -> RAPDU:
+        return self.backend.exchange(cla=CLA,
+                                     ins=InsType.DRY_RUN,
+                                     p1=P1.P1_DRY_RUN_HINT,
+                                     p2=index,
+                                     data=b"")
+
+    # Only supported by profiling builds
+    def get_profile(self, reset: bool = False) -> RAPDU:
+        return self.backend.exchange(cla=CLA,
+                                     ins=InsType.GET_PROFILE,
+                                     p1=P1.P1_PROFILE_RESET if reset else P1.P1_PROFILE_READ,
+                                     p2=P2.P2_NONE,
+                                     data=b"")
+
     def get_async_response(self) -> Optional[RAPDU]:
         return self.backend.last_async_response
@@ -1,4 +1,4 @@
-from typing import Tuple
+from typing import List, Tuple
 from struct import unpack
 
 # remainder, data_len, data
@@ -42,6 +42,20 @@ def unpack_get_app_and_version_response(response: bytes) -> Tuple[str, str]:
 
     return app_name_raw.decode("ascii"), version_raw.decode("ascii")
 
+# Unpack from response:
+# response = count (1)
+#            key_1 (32)
+#            ...
+#            key_count (32)
+def unpack_get_public_keys_batch_response(response: bytes) -> List[bytes]:
+    response, count_b = pop_sized_buf_from_buffer(response, 1)
+    assert len(response) == count_b[0] * 32
+    return [response[i * 32:(i + 1) * 32] for i in range(count_b[0])]
+
+def unpack_get_address_hashes_response(response: bytes) -> Tuple[bytes, List[bytes]]:
+    response, public_key = pop_sized_buf_from_buffer(response, 32)
+    return public_key, unpack_get_public_keys_batch_response(response)
+
 def unpack_sign_tx_response(response: bytes) -> Tuple[bytes, bytes]:
     response, sig_len, sig = pop_size_prefixed_buf_from_buf(response)
     response, hash_len, hash_b = pop_size_prefixed_buf_from_buf(response)
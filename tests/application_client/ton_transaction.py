@@ -1,6 +1,6 @@
 from dataclasses import dataclass
 from enum import IntFlag, IntEnum
-from typing import Optional
+from typing import List, Optional
 from abc import ABC, abstractmethod
 
 from tonsdk.utils import Address
@@ -157,6 +157,21 @@ class CustomUnsafePayload(Payload):
         return self.cell
 
 
+class BocPayload(Payload):
+    """Payload sent as a bag of cells, which the device decodes by itself."""
+    def __init__(self, cell: Cell) -> None:
+        self.cell = cell
+
+    def to_request_bytes(self) -> Optional[bytes]:
+        return None
+
+    def to_message_body_cell(self) -> Cell:
+        return self.cell
+
+    def to_boc(self) -> bytes:
+        return bytes(self.cell.to_boc(has_idx=False))
+
+
 class NFTTransferPayload(Payload):
     def __init__(self,
                  to: Address,
@@ -613,6 +628,11 @@ class Transaction:
             self.header_bytes(),
             self.seqno.to_bytes(4, byteorder="big"),
             self.timeout.to_bytes(4, byteorder="big"),
+            self.message_bytes()
+        ])
+
+    def message_bytes(self) -> bytes:
+        return b"".join([
             write_varuint(self.amount),
             write_address(self.to),
             bytes([1 if self.bounce else 0]),
@@ -635,6 +655,15 @@ class Transaction:
         if self.payload is None:
             return bytes([0, 0])
 
+        if isinstance(self.payload, BocPayload):
+            boc = self.payload.to_boc()
+            return b"".join([
+                bytes([2]),
+                len(boc).to_bytes(2, byteorder="big"),
+                boc,
+                bytes([0])
+            ])
+
         payload_bytes = self.payload.to_request_bytes()
         payload_cell = self.payload.to_message_body_cell()
         return b"".join([
@@ -680,3 +709,52 @@ class Transaction:
             .store_ref(self.order_cell())
             .end_cell()
         )
+
+
+class MultiMessageTransaction:
+    """Order of 1 to 4 messages signed at once, seqno and timeout of messages are ignored."""
+    def __init__(self,
+                 messages: List[Transaction],
+                 seqno: int,
+                 timeout: int,
+                 subwallet_id: Optional[int] = None,
+                 include_wallet_op: bool = True) -> None:
+        if not 1 <= len(messages) <= 4:
+            raise ValueError("An order must have 1 to 4 messages")
+        self.messages: List[Transaction] = messages
+        self.seqno: int = seqno
+        self.timeout: int = timeout
+        self.subwallet_id: Optional[int] = subwallet_id
+        self.include_wallet_op: bool = include_wallet_op
+
+    def to_request_bytes(self) -> bytes:
+        return b"".join([
+            bytes([2]),
+            (
+                (self.subwallet_id if self.subwallet_id is not None else 698983191)
+                .to_bytes(4, byteorder="big")
+            ),
+            bytes([1 if self.include_wallet_op else 0]),
+            self.seqno.to_bytes(4, byteorder="big"),
+            self.timeout.to_bytes(4, byteorder="big"),
+            bytes([len(self.messages)]),
+            *[m.message_bytes() for m in self.messages]
+        ])
+
+    def transfer_cell(self) -> Cell:
+        b = (
+            begin_cell()
+            .store_uint(698983191 if self.subwallet_id is None else self.subwallet_id, 32)
+            .store_uint(self.timeout, 32)
+            .store_uint(self.seqno, 32)
+        )
+
+        if self.include_wallet_op:
+            b = b.store_uint(0, 8)
+
+        for m in self.messages:
+            b = b.store_uint(m.send_mode, 8)
+        for m in self.messages:
+            b = b.store_ref(m.order_cell())
+
+        return b.end_cell()
@@ -46,12 +46,12 @@ def test_wrong_data_length(backend):
     assert e.value.status == Errors.SW_WRONG_DATA_LENGTH
 
 
-def test_invalid_state(backend):
+# Ensure a single SIGN_TX APDU starts with a valid path
+def test_single_apdu_bad_path(backend):
     with pytest.raises(ExceptionRAPDU) as e:
-        r = backend.exchange(cla=CLA,
+        backend.exchange(cla=CLA,
                          ins=InsType.SIGN_TX,
                          p1=P1.P1_NONE,
                          p2=P2.P2_FIRST,
                          data=b"abcde")
-        print(r)
-    assert e.value.status == Errors.SW_WRONG_P1P2
\ No newline at end of file
+    assert e.value.status == Errors.SW_WRONG_DATA_LENGTH
@@ -1,6 +1,7 @@
 import pytest
 
 from application_client.ton_command_sender import BoilerplateCommandSender, Errors, AddressDisplayFlags
+from application_client.ton_response_unpacker import unpack_get_public_keys_batch_response, unpack_get_address_hashes_response
 from ragger.error import ExceptionRAPDU
 from ragger.navigator import NavInsID, NavIns
 from utils import ROOT_SCREENSHOT_PATH
@@ -86,3 +87,47 @@ def test_get_public_key_bad_path(firmware, backend, navigator, test_name):
         # Assert that we have received a refusal
         assert e.value.status == Errors.SW_BAD_BIP32_PATH
         assert len(e.value.data) == 0
+
+
+# In this test we check that GET_PUBLIC_KEYS_BATCH returns the keys of consecutive indexes
+# across several APDUs, and that they match the keys returned by GET_PUBLIC_KEY
+def test_get_public_keys_batch(backend):
+    client = BoilerplateCommandSender(backend)
+    start = 0x80000000
+    keys = []
+    while len(keys) < 10:
+        response = client.get_public_keys_batch(path="m/44'/607'/0'/0'",
+                                                start=start + len(keys),
+                                                count=10 - len(keys)).data
+        keys += unpack_get_public_keys_batch_response(response)
+    for i, key in enumerate(keys):
+        assert key == client.get_public_key(path=f"m/44'/607'/0'/0'/{i}'").data
+
+
+# In this test we check that GET_PUBLIC_KEYS_BATCH rejects indexes crossing the hardened boundary
+def test_get_public_keys_batch_crossing_hardened(backend):
+    client = BoilerplateCommandSender(backend)
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.get_public_keys_batch(path="m/44'/607'/0'/0'", start=0x7FFFFFFF, count=2)
+    assert e.value.status == Errors.SW_BAD_BIP32_PATH
+
+
+# In this test we check that GET_PUBLIC_KEY returns the address hashes of all wallet versions
+def test_get_address_hashes(backend):
+    client = BoilerplateCommandSender(backend)
+    public_key, hashes = unpack_get_address_hashes_response(
+        client.get_address_hashes(path="m/44'/607'/0'/0'/0'/0'").data)
+    assert public_key == client.get_public_key(path="m/44'/607'/0'/0'/0'/0'").data
+    # v4R2 and v3R2
+    assert len(hashes) == 2
+    assert hashes[0] != hashes[1]
+    batch = client.get_public_keys_batch(path="m/44'/607'/0'/0'/0'", start=0, count=1, address_hashes=True).data
+    assert hashes[0] == unpack_get_public_keys_batch_response(batch)[0]
+
+    # The default subwallet id gives the default addresses, other ones do not
+    _, default_hashes = unpack_get_address_hashes_response(
+        client.get_address_hashes(path="m/44'/607'/0'/0'/0'/0'", subwallet_id=698983191).data)
+    assert default_hashes == hashes
+    _, other_hashes = unpack_get_address_hashes_response(
+        client.get_address_hashes(path="m/44'/607'/0'/0'/0'/0'", subwallet_id=1).data)
+    assert other_hashes[0] != hashes[0] and other_hashes[1] != hashes[1]
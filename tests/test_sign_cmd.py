@@ -294,4 +294,15 @@ def test_sign_tx_refused(firmware, backend, navigator, test_name):
                                                    instructions)
             # Assert that we have received a refusal
             assert e.value.status == Errors.SW_DENY
-            assert len(e.value.data) == 0
\ No newline at end of file
+            assert len(e.value.data) == 0
+
+# Transactions of a batch can not be signed before the batch is approved
+def test_sign_tx_batch_not_approved(backend):
+    client = BoilerplateCommandSender(backend)
+
+    tx = Transaction(Address("0:" + "0" * 64), SendMode.PAY_GAS_SEPARATLY, 0, 1686176000, True, 100000000)
+
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.sign_tx_batch_transaction(tx.to_request_bytes())
+
+    assert e.value.status == Errors.SW_BAD_STATE
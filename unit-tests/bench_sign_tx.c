@@ -0,0 +1,161 @@
+/**
+ * Microbenchmarks of the transaction signing pipeline on host.
+ *
+ * Not part of the test suite, run manually with:
+ *
+ *   ./build/bench_sign_tx [iterations]
+ *
+ * When built with -DPROFILE=ON, the time spent in each phase of the transactions and
+ * the number of cells and blocks hashed are reported as well.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cx.h"
+
+#include "types.h"
+#include "address.h"
+#include "common/base64.h"
+#include "common/bits.h"
+#include "common/buffer.h"
+#include "common/cell.h"
+#include "common/format_address.h"
+#include "common/profile.h"
+#include "transaction/deserialize.h"
+#include "transaction/hash.h"
+#include "transaction/request.h"
+
+#include "tx_vectors.h"
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+static void report(const char *name, uint64_t start, unsigned long iterations) {
+    uint64_t elapsed = now_ns() - start;
+    printf("%-24s %10.1f ns/op\n", name, (double) elapsed / (double) iterations);
+}
+
+static void bench_tx(const tx_vector_t *v, unsigned long iterations) {
+    static transaction_ctx_t ctx;
+    char name[32];
+
+    uint64_t start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        buffer_t buf = {.ptr = v->request, .size = v->request_len, .offset = 0};
+        memset(&ctx.transaction, 0, sizeof(ctx.transaction));
+        transaction_deserialize_init(&ctx.transaction);
+        if (request_deserialize_chunk(&buf, &ctx.transaction, true) != PARSING_OK ||
+            !request_hash(&ctx)) {
+            fprintf(stderr, "%s: failed\n", v->name);
+            exit(EXIT_FAILURE);
+        }
+    }
+    snprintf(name, sizeof(name), "tx/%s", v->name);
+    report(name, start, iterations);
+}
+
+#ifdef HAVE_PROFILE
+static void report_profile(unsigned long requests) {
+    static const char *phases[PROFILE_PHASES_COUNT] =
+        {"apdu", "deserialize", "hints", "hash", "ui", "derive", "sign"};
+    static const char *counters[PROFILE_COUNTERS_COUNT] = {"hash_cell", "cx_hash"};
+
+    for (size_t i = 0; i < PROFILE_PHASES_COUNT; i++) {
+        if (G_profile.phases[i].calls > 0) {
+            printf("profile/%-16s %10.1f ns/request %8.2f calls/request\n",
+                   phases[i],
+                   (double) G_profile.phases[i].ticks / (double) requests,
+                   (double) G_profile.phases[i].calls / (double) requests);
+        }
+    }
+    for (size_t i = 0; i < PROFILE_COUNTERS_COUNT; i++) {
+        printf("profile/%-16s %10.2f /request\n",
+               counters[i],
+               (double) G_profile.counters[i] / (double) requests);
+    }
+}
+#endif
+
+int main(int argc, char *argv[]) {
+    unsigned long iterations = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+    uint8_t data[128] = {0};
+    uint8_t out[HASH_LEN];
+    uint64_t start;
+
+    if (iterations == 0) {
+        return EXIT_FAILURE;
+    }
+
+    start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        cx_sha256_t state;
+        cx_sha256_init_no_throw(&state);
+        cx_hash_no_throw((cx_hash_t *) &state, CX_LAST, data, sizeof(data), out, sizeof(out));
+    }
+    report("sha256/128", start, iterations);
+
+    start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BitString_t bits;
+        BitString_init(&bits);
+        BitString_storeUint(&bits, 0x0f8a7ea5, 32);
+        BitString_storeUint(&bits, i, 64);
+        BitString_storeCoins(&bits, i);
+        BitString_storeAddress(&bits, 0x00, data);
+        BitString_storeAddress(&bits, 0x00, data);
+    }
+    report("bits/jetton_body", start, iterations);
+
+    start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BitString_t bits;
+        CellRef_t ref;
+        BitString_init(&bits);
+        BitString_storeBuffer(&bits, data, 120);
+        hash_Cell(&bits, NULL, 0, &ref);
+    }
+    report("cell/120_bytes", start, iterations);
+
+    start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        pubkey_to_hash(data, out, sizeof(out));
+    }
+    report("address/v4r2", start, iterations);
+
+    start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        uint8_t address[ADDRESS_LEN];
+        char friendly[FRIENDLY_ADDRESS_LEN + 1];
+        address_to_friendly(0x00, out, true, false, address, sizeof(address));
+        base64_encode(address, sizeof(address), friendly, sizeof(friendly));
+    }
+    report("address/friendly_2pass", start, iterations);
+
+    start = now_ns();
+    for (unsigned long i = 0; i < iterations; i++) {
+        char friendly[FRIENDLY_ADDRESS_LEN + 1];
+        address_to_friendly_base64(0x00, out, true, false, friendly, sizeof(friendly));
+    }
+    report("address/friendly", start, iterations);
+
+#ifdef HAVE_PROFILE
+    profile_reset();
+#endif
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        bench_tx(&vectors[i], iterations);
+    }
+#ifdef HAVE_PROFILE
+    report_profile(iterations * (sizeof(vectors) / sizeof(vectors[0])));
+#endif
+
+    return EXIT_SUCCESS;
+}
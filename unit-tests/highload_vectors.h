@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stdint.h>
+
+// Requests and expected order hashes were generated with an independent
+// implementation of the highload wallet v3 order serialization.
+
+static const uint8_t highload_header[] = {
+    0x03, 0x00, 0x00, 0x10, 0xad, 0x00, 0x00, 0x14, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x65, 0x53, 0xf1, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x04, 0x3b, 0x9a,
+    0xca, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x01,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x03,
+};
+static const uint8_t highload_action_0[] = {
+    0x04, 0x05, 0xf5, 0xe1, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00,
+};
+static const uint8_t highload_action_1[] = {
+    0x04, 0x0b, 0xeb, 0xc2, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+};
+static const uint8_t highload_action_2[] = {
+    0x04, 0x11, 0xe1, 0xa3, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+};
+static const uint8_t highload_hash[] = {
+    0x92, 0xed, 0x64, 0x36, 0xaf, 0x2e, 0x09, 0x54, 0x09, 0xd9, 0xcc, 0xe2,
+    0x70, 0x72, 0x31, 0x8f, 0x70, 0x0c, 0x94, 0xe3, 0xe7, 0xbc, 0x0c, 0x3a,
+    0x63, 0x26, 0x64, 0xbb, 0x0b, 0x23, 0xb1, 0x01,
+};
+static const uint8_t highload_many_header[] = {
+    0x03, 0x00, 0x00, 0x10, 0xad, 0x00, 0x00, 0x14, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x65, 0x53, 0xf1, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x04, 0x3b, 0x9a,
+    0xca, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x01,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x14,
+};
+static const uint8_t highload_many_actions[] = {
+    0x02, 0x03, 0xe8, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe9, 0x00, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03,
+    0xea, 0x00, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x03, 0xeb, 0x00, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0x00,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0xed, 0x00, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+    0x85, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0xe4, 0x73, 0xae, 0xf4, 0xdd,
+    0x06, 0x28, 0x7f, 0xdd, 0xb8, 0x48, 0x73, 0xfa, 0x21, 0xe6, 0x6c, 0xfb,
+    0x40, 0x3b, 0x85, 0x7b, 0x4e, 0x6a, 0x0e, 0xf9, 0x6f, 0x0d, 0xad, 0x2f,
+    0xa5, 0x92, 0xbf, 0x00, 0x02, 0x03, 0xee, 0x00, 0x86, 0x86, 0x86, 0x86,
+    0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+    0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+    0x86, 0x86, 0x86, 0x86, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xef,
+    0x00, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+    0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0xf0, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xf1, 0x00, 0x89,
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0xf2, 0x00, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+    0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xf3, 0x00, 0x8b, 0x8b, 0x8b,
+    0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b,
+    0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b,
+    0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03,
+    0xf4, 0x00, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+    0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x03, 0xf5, 0x00, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+    0x8d, 0x8d, 0x8d, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xf6, 0x00,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0xf7, 0x00, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+    0x8f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xf8, 0x00, 0x90, 0x90,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x03, 0xf9, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xfa, 0x00, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0xfb,
+    0x00, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x01, 0x01, 0x00,
+    0x00, 0x00,
+};
+static const uint8_t highload_many_hash[] = {
+    0x8e, 0x5f, 0x16, 0x56, 0xf8, 0x62, 0x05, 0xba, 0xc9, 0x6c, 0x0c, 0x12,
+    0xe8, 0x6c, 0x28, 0x97, 0x5e, 0x3d, 0xba, 0x6c, 0x31, 0xd6, 0xb6, 0x73,
+    0xa8, 0x6b, 0x99, 0xbc, 0xd0, 0xe4, 0x7b, 0x96,
+};
@@ -0,0 +1,102 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "address.h"
+
+static const uint8_t pubkey[] = {
+    0x8f, 0x7c, 0x4c, 0x3b, 0x0d, 0x1e, 0x2a, 0x5f, 0x6b, 0x7c, 0x8d, 0x9e,
+    0x0f, 0xa1, 0xb2, 0xc3, 0xd4, 0xe5, 0xf6, 0x07, 0x18, 0x29, 0x3a, 0x4b,
+    0x5c, 0x6d, 0x7e, 0x8f, 0x90, 0xa1, 0xb2, 0xc3,
+};
+
+static const uint8_t pubkey_v4r2_hash[] = {
+    0xb5, 0x5a, 0xc3, 0x17, 0x4f, 0xc1, 0x41, 0x1a, 0xf6, 0x31, 0x5a, 0xf5,
+    0x29, 0x90, 0xbb, 0x77, 0x31, 0x10, 0x25, 0xa9, 0x4d, 0xfe, 0x70, 0xa6,
+    0xaf, 0x99, 0x3f, 0x17, 0x24, 0xf4, 0xfd, 0x3f,
+};
+
+static const uint8_t pubkey_v4r2_subwallet_hash[] = {
+    0x79, 0xc9, 0xe1, 0x72, 0x21, 0x0f, 0x4d, 0xb0, 0x3f, 0x99, 0x5d, 0x70,
+    0x9a, 0x65, 0xf4, 0x6b, 0xa9, 0x9d, 0x28, 0x32, 0xca, 0x70, 0xe4, 0x79,
+    0x62, 0xa2, 0x69, 0x50, 0xc9, 0xec, 0x79, 0xe5,
+};
+
+static const uint8_t pubkey_v3r2_hash[] = {
+    0xd9, 0xf8, 0xa2, 0x63, 0x38, 0xbc, 0x43, 0x3d, 0xd3, 0xd2, 0xb8, 0x74,
+    0x16, 0xcd, 0xbd, 0x65, 0x5d, 0xbb, 0x55, 0x97, 0x86, 0xf1, 0x5b, 0x35,
+    0x2b, 0x64, 0x9e, 0xed, 0x61, 0xcf, 0xf0, 0x5e,
+};
+
+static void test_pubkey_to_hash(void **state) {
+    (void) state;
+
+    uint8_t hash[HASH_LEN];
+
+    assert_true(pubkey_to_hash(pubkey, hash, sizeof(hash)));
+    assert_memory_equal(hash, pubkey_v4r2_hash, sizeof(hash));
+
+    assert_false(pubkey_to_hash(pubkey, hash, sizeof(hash) - 1));
+}
+
+static void test_wallet_to_hash(void **state) {
+    (void) state;
+
+    uint8_t hash[HASH_LEN];
+
+    assert_true(wallet_to_hash(WALLET_V4R2, DEFAULT_SUBWALLET_ID, pubkey, hash));
+    assert_memory_equal(hash, pubkey_v4r2_hash, sizeof(hash));
+
+    assert_true(wallet_to_hash(WALLET_V4R2, DEFAULT_SUBWALLET_ID + 1, pubkey, hash));
+    assert_memory_equal(hash, pubkey_v4r2_subwallet_hash, sizeof(hash));
+
+    assert_true(wallet_to_hash(WALLET_V3R2, DEFAULT_SUBWALLET_ID, pubkey, hash));
+    assert_memory_equal(hash, pubkey_v3r2_hash, sizeof(hash));
+
+    assert_false(wallet_to_hash(WALLET_VERSIONS_COUNT, DEFAULT_SUBWALLET_ID, pubkey, hash));
+}
+
+static void test_wallet_descriptors(void **state) {
+    (void) state;
+
+    assert_string_equal(wallet_name(WALLET_V4R2), "v4R2");
+    assert_string_equal(wallet_name(WALLET_V3R2), "v3R2");
+    assert_null(wallet_name(WALLET_VERSIONS_COUNT));
+
+    for (int version = 0; version < WALLET_VERSIONS_COUNT; version++) {
+        assert_int_equal(wallet_default_subwallet_id((wallet_version_e) version),
+                         DEFAULT_SUBWALLET_ID);
+    }
+}
+
+static void test_address_from_pubkey(void **state) {
+    (void) state;
+
+    uint8_t address[ADDRESS_LEN];
+
+    assert_true(address_from_pubkey(pubkey, 0x00, true, false, address, sizeof(address)));
+    // Tag, workchain, account id
+    assert_int_equal(address[0], 0x11);
+    assert_int_equal(address[1], 0x00);
+    assert_memory_equal(&address[2], pubkey_v4r2_hash, HASH_LEN);
+
+    assert_true(address_from_pubkey(pubkey, 0xff, false, true, address, sizeof(address)));
+    assert_int_equal(address[0], 0x51 | 0x80);
+    assert_int_equal(address[1], 0xff);
+
+    assert_false(address_from_pubkey(pubkey, 0x00, true, false, address, sizeof(address) - 1));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_pubkey_to_hash),
+                                       cmocka_unit_test(test_wallet_to_hash),
+                                       cmocka_unit_test(test_wallet_descriptors),
+                                       cmocka_unit_test(test_address_from_pubkey)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
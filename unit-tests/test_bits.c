@@ -118,13 +118,108 @@ static void test_addr(void **state) {
     assert_memory_equal(bits.data, expected, sizeof(expected));
 }
 
+// Bit-by-bit reference writer, used to check the word-level implementation
+static void ref_store_uint(BitString_t *self, uint64_t v, uint8_t bits) {
+    for (int i = 0; i < bits; i++) {
+        BitString_storeBit(self, (v >> (bits - i - 1)) & 0x01);
+    }
+}
+
+static void test_store_uint_matches_reference(void **state) {
+    uint64_t seed = 0x9e3779b97f4a7c15;
+    for (int round = 0; round < 200; round++) {
+        BitString_t bits;
+        BitString_t ref;
+        BitString_init(&bits);
+        BitString_init(&ref);
+        while (1) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            uint8_t len = (seed >> 58) + 1;  // 1..64
+            if (bits.data_cursor + len > 1023) {
+                break;
+            }
+            BitString_storeUint(&bits, seed, len);
+            ref_store_uint(&ref, seed, len);
+            assert_int_equal(bits.data_cursor, ref.data_cursor);
+        }
+        BitString_finalize(&bits);
+        BitString_finalize(&ref);
+        assert_int_equal(bits.data_cursor, ref.data_cursor);
+        assert_memory_equal(bits.data, ref.data, sizeof(bits.data));
+    }
+}
+
+static void test_store_uint_overwrites(void **state) {
+    BitString_t bits;
+    BitString_init(&bits);
+    memset(bits.data, 0xff, sizeof(bits.data));
+    BitString_storeUint(&bits, 0, 3);
+    BitString_storeUint(&bits, 0x2, 7);
+    assert_int_equal(bits.data_cursor, 10);
+    assert_int_equal(bits.data[0], 0x00);
+    assert_int_equal(bits.data[1] & 0xc0, 0x80);
+}
+
+static void test_store_uint_64_every_offset(void **state) {
+    for (int shift = 0; shift < 8; shift++) {
+        BitString_t bits;
+        BitString_t ref;
+        BitString_init(&bits);
+        BitString_init(&ref);
+        memset(bits.data, 0xff, sizeof(bits.data));
+        memset(ref.data, 0xff, sizeof(ref.data));
+        BitString_storeUint(&bits, 0, shift);
+        ref_store_uint(&ref, 0, shift);
+        BitString_storeUint(&bits, 0x0123456789abcdef, 64);
+        ref_store_uint(&ref, 0x0123456789abcdef, 64);
+        BitString_storeUint(&bits, 0x8000000000000001, 64);
+        ref_store_uint(&ref, 0x8000000000000001, 64);
+        assert_int_equal(bits.data_cursor, shift + 128);
+        assert_memory_equal(bits.data, ref.data, sizeof(bits.data));
+    }
+}
+
+static void test_store_buffer_unaligned(void **state) {
+    uint8_t hash[32];
+    for (int i = 0; i < 32; i++) {
+        hash[i] = i * 7 + 1;
+    }
+    for (int shift = 0; shift < 8; shift++) {
+        BitString_t bits;
+        BitString_t ref;
+        BitString_init(&bits);
+        BitString_init(&ref);
+        BitString_storeUint(&bits, 0x5a, shift);
+        ref_store_uint(&ref, 0x5a, shift);
+        BitString_storeBuffer(&bits, hash, sizeof(hash));
+        for (int i = 0; i < 32; i++) {
+            ref_store_uint(&ref, hash[i], 8);
+        }
+        BitString_storeAddress(&bits, 0xff, hash);
+        ref_store_uint(&ref, 2, 2);
+        ref_store_uint(&ref, 0, 1);
+        ref_store_uint(&ref, 0xff, 8);
+        for (int i = 0; i < 32; i++) {
+            ref_store_uint(&ref, hash[i], 8);
+        }
+        assert_int_equal(bits.data_cursor, ref.data_cursor);
+        assert_memory_equal(bits.data, ref.data, sizeof(bits.data));
+    }
+}
+
 int main() {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_bits),
         cmocka_unit_test(test_bits_2),
         cmocka_unit_test(test_coins_buf),
         cmocka_unit_test(test_null_addr),
-        cmocka_unit_test(test_addr)
+        cmocka_unit_test(test_addr),
+        cmocka_unit_test(test_store_uint_matches_reference),
+        cmocka_unit_test(test_store_uint_overwrites),
+        cmocka_unit_test(test_store_uint_64_every_offset),
+        cmocka_unit_test(test_store_buffer_unaligned)
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,213 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/boc.h"
+
+// Bags of cells and expected hashes were generated with an independent
+// implementation of the bag of cells serialization.
+
+// Jetton transfer with forward payload in a reference
+static const uint8_t jetton_boc[] = {
+    0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x03, 0x01, 0x00, 0x00, 0x65, 0x00,
+    0x01, 0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2a, 0x30, 0xf4, 0x24, 0x09, 0xfe, 0x00, 0x02, 0x04, 0x06, 0x08,
+    0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e, 0x20,
+    0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30, 0x32, 0x34, 0x36, 0x38,
+    0x3a, 0x3c, 0x3f, 0x00, 0x39, 0x74, 0xb2, 0x2e, 0x28, 0xbc, 0xec, 0x70,
+    0x35, 0x39, 0xbd, 0xea, 0x2e, 0x72, 0xb6, 0xfb, 0x3f, 0x43, 0x87, 0xc8,
+    0x0c, 0x50, 0x94, 0xd9, 0x1d, 0x61, 0xa5, 0xea, 0x2e, 0x72, 0xb6, 0xfb,
+    0x02, 0x03, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x65, 0x6d,
+    0x6f, 0x02, 0x00, 0x01, 0xb0, 0x4f, 0x06, 0xae, 0x92,
+};
+
+// Same with the forward payload pruned, with index and without CRC
+static const uint8_t jetton_pruned_boc[] = {
+    0xb5, 0xee, 0x9c, 0x72, 0x81, 0x02, 0x02, 0x01, 0x00, 0x00, 0x7d, 0x00,
+    0x00, 0x57, 0x00, 0x7d, 0x21, 0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0xf4, 0x24, 0x09, 0xfe, 0x00,
+    0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18,
+    0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30,
+    0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3f, 0x00, 0x39, 0x74, 0xb2, 0x2e,
+    0x28, 0xbc, 0xec, 0x70, 0x35, 0x39, 0xbd, 0xea, 0x2e, 0x72, 0xb6, 0xfb,
+    0x3f, 0x43, 0x87, 0xc8, 0x0c, 0x50, 0x94, 0xd9, 0x1d, 0x61, 0xa5, 0xea,
+    0x2e, 0x72, 0xb6, 0xfb, 0x02, 0x03, 0x01, 0x28, 0x48, 0x01, 0x01, 0xf5,
+    0xe0, 0x37, 0x39, 0xb6, 0xc1, 0xef, 0xfa, 0x9d, 0x5a, 0x69, 0x79, 0xd4,
+    0xa0, 0x1c, 0xe8, 0x5d, 0xbb, 0xa1, 0x4a, 0xa3, 0x84, 0x6a, 0x14, 0x2e,
+    0x4f, 0xd7, 0xbb, 0x97, 0xdf, 0xae, 0x4f, 0x00, 0x01,
+};
+
+static const uint8_t jetton_hash[] = {
+    0xce, 0x9d, 0x7a, 0xe3, 0xf0, 0x83, 0xef, 0x2b, 0xa7, 0x50, 0xaf, 0x10,
+    0x31, 0x0f, 0x2c, 0x0e, 0x28, 0x88, 0xdc, 0xa2, 0x14, 0xe7, 0x29, 0x26,
+    0x1c, 0xaa, 0xe0, 0xff, 0xec, 0x8d, 0x97, 0x9f,
+};
+
+static const uint8_t forward_payload_hash[] = {
+    0xf5, 0xe0, 0x37, 0x39, 0xb6, 0xc1, 0xef, 0xfa, 0x9d, 0x5a, 0x69, 0x79,
+    0xd4, 0xa0, 0x1c, 0xe8, 0x5d, 0xbb, 0xa1, 0x4a, 0xa3, 0x84, 0x6a, 0x14,
+    0x2e, 0x4f, 0xd7, 0xbb, 0x97, 0xdf, 0xae, 0x4f,
+};
+
+// Chain of 9 cells
+static const uint8_t chain_boc[] = {
+    0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x09, 0x01, 0x00, 0x00, 0x23, 0x00,
+    0x01, 0x02, 0x07, 0x01, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02, 0x05, 0x03,
+    0x01, 0x02, 0x04, 0x04, 0x01, 0x02, 0x03, 0x05, 0x01, 0x02, 0x02, 0x06,
+    0x01, 0x02, 0x01, 0x07, 0x01, 0x02, 0x00, 0x08, 0x00, 0x01, 0xc0, 0x50,
+    0xbd, 0x70, 0xd5,
+};
+
+static uint8_t boc_data[384];
+
+static void parse(const uint8_t *boc, size_t len, size_t chunk, Boc_t *out, CellRef_t *root) {
+    Boc_init(out, boc_data, sizeof(boc_data));
+    for (size_t offset = 0; offset < len; offset += chunk) {
+        size_t n = len - offset < chunk ? len - offset : chunk;
+        assert_true(Boc_feed(out, &boc[offset], n));
+    }
+    assert_true(Boc_finalize(out, root));
+}
+
+static void test_boc_parse(void **state) {
+    (void) state;
+
+    static Boc_t boc;
+    CellRef_t root;
+
+    for (size_t chunk = 1; chunk <= sizeof(jetton_boc); chunk++) {
+        parse(jetton_boc, sizeof(jetton_boc), chunk, &boc, &root);
+        assert_int_equal(root.max_depth, 2);
+        assert_memory_equal(root.hash, jetton_hash, HASH_LEN);
+    }
+
+    parse(jetton_pruned_boc, sizeof(jetton_pruned_boc), sizeof(jetton_pruned_boc), &boc, &root);
+    assert_int_equal(root.max_depth, 2);
+    assert_memory_equal(root.hash, jetton_hash, HASH_LEN);
+}
+
+static void test_boc_errors(void **state) {
+    (void) state;
+
+    static Boc_t boc;
+    uint8_t data[sizeof(jetton_boc) + 1];
+    CellRef_t root;
+
+    // Bad CRC
+    memcpy(data, jetton_boc, sizeof(jetton_boc));
+    data[sizeof(jetton_boc) - 1] ^= 0x01;
+    Boc_init(&boc, boc_data, sizeof(boc_data));
+    assert_false(Boc_feed(&boc, data, sizeof(jetton_boc)));
+
+    // Corrupted data
+    memcpy(data, jetton_boc, sizeof(jetton_boc));
+    data[20] ^= 0x01;
+    Boc_init(&boc, boc_data, sizeof(boc_data));
+    assert_false(Boc_feed(&boc, data, sizeof(jetton_boc)));
+
+    // Trailing data
+    memcpy(data, jetton_boc, sizeof(jetton_boc));
+    data[sizeof(jetton_boc)] = 0x00;
+    Boc_init(&boc, boc_data, sizeof(boc_data));
+    assert_false(Boc_feed(&boc, data, sizeof(data)));
+    assert_false(Boc_finalize(&boc, &root));
+
+    // Incomplete
+    Boc_init(&boc, boc_data, sizeof(boc_data));
+    assert_true(Boc_feed(&boc, jetton_boc, sizeof(jetton_boc) - 1));
+    assert_false(Boc_finalize(&boc, &root));
+
+    // Bad magic
+    memcpy(data, jetton_boc, sizeof(jetton_boc));
+    data[0] = 0x68;
+    Boc_init(&boc, boc_data, sizeof(boc_data));
+    assert_false(Boc_feed(&boc, data, sizeof(jetton_boc)));
+
+    // Too many cells
+    Boc_init(&boc, boc_data, sizeof(boc_data));
+    assert_false(Boc_feed(&boc, chain_boc, sizeof(chain_boc)));
+
+    // Cell data does not fit
+    Boc_init(&boc, boc_data, 8);
+    assert_false(Boc_feed(&boc, jetton_boc, sizeof(jetton_boc)));
+}
+
+static void test_cell_slice(void **state) {
+    (void) state;
+
+    static Boc_t boc;
+    CellRef_t root;
+    CellSlice_t slice;
+    uint64_t v;
+    bool flag;
+    uint8_t amount[15];
+    uint8_t amount_len;
+    address_t address;
+    uint8_t index;
+    CellRef_t ref;
+    const uint8_t *text;
+
+    parse(jetton_boc, sizeof(jetton_boc), sizeof(jetton_boc), &boc, &root);
+    assert_true(CellSlice_init(&slice, &boc, 0));
+    assert_int_equal(CellSlice_remainingBits(&slice), 672);
+    assert_int_equal(CellSlice_remainingRefs(&slice), 1);
+
+    assert_true(CellSlice_loadUint(&slice, 32, &v));
+    assert_int_equal(v, 0x0f8a7ea5);
+    assert_true(CellSlice_loadUint(&slice, 64, &v));
+    assert_int_equal(v, 42);
+    assert_true(CellSlice_loadCoins(&slice, &amount_len, amount, sizeof(amount)));
+    assert_int_equal(amount_len, 3);
+    assert_int_equal(amount[0], 0x0f);
+    assert_int_equal(amount[1], 0x42);
+    assert_int_equal(amount[2], 0x40);
+    assert_true(CellSlice_loadAddress(&slice, &address));
+    assert_int_equal(address.chain, 0xff);
+    assert_int_equal(address.hash[31], 31);
+    assert_true(CellSlice_loadAddress(&slice, &address));
+    assert_int_equal(address.chain, 0x00);
+    assert_int_equal(address.hash[0], 0xe5);
+    assert_true(CellSlice_loadBit(&slice, &flag));
+    assert_false(flag);
+    assert_true(CellSlice_loadCoins(&slice, &amount_len, amount, sizeof(amount)));
+    assert_int_equal(amount_len, 1);
+    assert_int_equal(amount[0], 1);
+    assert_true(CellSlice_loadBit(&slice, &flag));
+    assert_true(flag);
+    assert_int_equal(CellSlice_remainingBits(&slice), 0);
+    assert_false(CellSlice_loadBit(&slice, &flag));
+
+    assert_true(CellSlice_loadRefHash(&slice, &ref));
+    assert_int_equal(ref.max_depth, 1);
+    assert_memory_equal(ref.hash, forward_payload_hash, HASH_LEN);
+    assert_false(CellSlice_loadRef(&slice, &index));
+
+    // Forward payload
+    slice.refs_cursor = 0;
+    assert_true(CellSlice_loadRef(&slice, &index));
+    assert_true(CellSlice_init(&slice, &boc, index));
+    assert_int_equal(CellSlice_remainingBits(&slice), 64);
+    assert_true(CellSlice_loadUint(&slice, 32, &v));
+    assert_int_equal(v, 0);
+    assert_true(CellSlice_loadBufferRef(&slice, &text, 4));
+    assert_memory_equal(text, "memo", 4);
+
+    // Pruned cells can not be read
+    parse(jetton_pruned_boc, sizeof(jetton_pruned_boc), sizeof(jetton_pruned_boc), &boc, &root);
+    assert_true(CellSlice_init(&slice, &boc, 0));
+    assert_true(CellSlice_loadRef(&slice, &index));
+    assert_false(CellSlice_init(&slice, &boc, index));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_boc_parse),
+                                       cmocka_unit_test(test_boc_errors),
+                                       cmocka_unit_test(test_cell_slice)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,157 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "cx.h"
+
+#include "common/bits.h"
+#include "common/cell.h"
+
+static const uint8_t sha256_abc[] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde,
+    0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+    0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+};
+
+static const uint8_t sha256_two_blocks[] = {
+    0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93,
+    0x0c, 0x3e, 0x60, 0x39, 0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+    0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1,
+};
+
+static const uint8_t sha256_million[] = {
+    0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2,
+    0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+    0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0,
+};
+
+static const uint8_t empty_cell_hash[] = {
+    0x96, 0xa2, 0x96, 0xd2, 0x24, 0xf2, 0x85, 0xc6, 0x7b, 0xee, 0x93, 0xc3,
+    0x0f, 0x8a, 0x30, 0x91, 0x57, 0xf0, 0xda, 0xa3, 0x5d, 0xc5, 0xb8, 0x7e,
+    0x41, 0x0b, 0x78, 0x63, 0x0a, 0x09, 0xcf, 0xc7,
+};
+
+static const uint8_t cell_hash[] = {
+    0x0d, 0xe8, 0x37, 0xd3, 0x4a, 0x98, 0x81, 0xbe, 0xd5, 0x5f, 0x98, 0xe0,
+    0x76, 0xda, 0x16, 0xc6, 0x64, 0x91, 0x34, 0x71, 0xcf, 0x8e, 0xff, 0xf7,
+    0x4a, 0xdb, 0xfd, 0x31, 0x7d, 0x28, 0xe2, 0x1f,
+};
+
+static void sha256(const uint8_t *data, size_t len, size_t chunk, uint8_t out[32]) {
+    cx_sha256_t state;
+    assert_int_equal(cx_sha256_init_no_throw(&state), CX_OK);
+    while (len > chunk) {
+        assert_int_equal(cx_hash_no_throw((cx_hash_t *) &state, 0, data, chunk, NULL, 0), CX_OK);
+        data += chunk;
+        len -= chunk;
+    }
+    assert_int_equal(cx_hash_no_throw((cx_hash_t *) &state, CX_LAST, data, len, out, 32), CX_OK);
+}
+
+static const uint8_t snake_chain_hash[] = {
+    0x43, 0x63, 0xf6, 0x95, 0xab, 0x0c, 0x0f, 0x4c, 0x63, 0xb8, 0xff, 0xa9,
+    0xab, 0x91, 0x99, 0x80, 0xe4, 0x24, 0x99, 0xea, 0x92, 0xce, 0xc8, 0x3b,
+    0x54, 0xc6, 0x5f, 0xab, 0xc0, 0x87, 0x15, 0x40,
+};
+
+static void test_sha256(void **state) {
+    (void) state;
+
+    static uint8_t million[1000000];
+    uint8_t out[32];
+    const char *two_blocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+    sha256((const uint8_t *) "abc", 3, 3, out);
+    assert_memory_equal(out, sha256_abc, sizeof(out));
+
+    // Same digest whatever the way input is split
+    for (size_t chunk = 1; chunk <= 64; chunk++) {
+        sha256((const uint8_t *) two_blocks, strlen(two_blocks), chunk, out);
+        assert_memory_equal(out, sha256_two_blocks, sizeof(out));
+    }
+
+    memset(million, 'a', sizeof(million));
+    sha256(million, sizeof(million), 1000, out);
+    assert_memory_equal(out, sha256_million, sizeof(out));
+}
+
+static void test_hash_empty_cell(void **state) {
+    (void) state;
+
+    BitString_t bits;
+    CellRef_t ref;
+
+    BitString_init(&bits);
+    assert_true(hash_Cell(&bits, NULL, 0, &ref));
+    assert_int_equal(ref.max_depth, 0);
+    assert_memory_equal(ref.hash, empty_cell_hash, sizeof(ref.hash));
+}
+
+static void test_hash_cell_with_refs(void **state) {
+    (void) state;
+
+    BitString_t bits;
+    CellRef_t empty;
+    CellRef_t refs[2];
+    CellRef_t ref;
+
+    BitString_init(&bits);
+    assert_true(hash_Cell(&bits, NULL, 0, &empty));
+
+    BitString_init(&bits);
+    BitString_storeUint(&bits, 7, 8);
+    assert_true(hash_Cell(&bits, &empty, 1, &refs[1]));
+    assert_int_equal(refs[1].max_depth, 1);
+    refs[0] = empty;
+
+    BitString_init(&bits);
+    BitString_storeUint(&bits, 0x0f8a7ea5, 32);
+    BitString_storeUint(&bits, 1, 3);
+    assert_true(hash_Cell(&bits, refs, 2, &ref));
+    assert_int_equal(ref.max_depth, 2);
+    assert_memory_equal(ref.hash, cell_hash, sizeof(ref.hash));
+}
+
+static void test_hash_snake_data(void **state) {
+    (void) state;
+
+    BitString_t bits;
+    CellRef_t ref;
+    bool has_ref;
+    uint8_t data[400];
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) i;
+    }
+
+    // Fits in the head cell
+    BitString_init(&bits);
+    BitString_storeUint(&bits, 0, 32);
+    assert_true(hash_SnakeData(&bits, data, 123, &ref, &has_ref));
+    assert_false(has_ref);
+    assert_int_equal(bits.data_cursor, 32 + 123 * 8);
+
+    // Head cell, then two full cells and a last one of 23 bytes
+    BitString_init(&bits);
+    BitString_storeUint(&bits, 0, 32);
+    assert_true(hash_SnakeData(&bits, data, sizeof(data), &ref, &has_ref));
+    assert_true(has_ref);
+    assert_int_equal(bits.data_cursor, 32 + 123 * 8);
+    assert_memory_equal(bits.data + 4, data, 123);
+    assert_int_equal(ref.max_depth, 2);
+    assert_memory_equal(ref.hash, snake_chain_hash, sizeof(ref.hash));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_sha256),
+                                       cmocka_unit_test(test_hash_empty_cell),
+                                       cmocka_unit_test(test_hash_cell_with_refs),
+                                       cmocka_unit_test(test_hash_snake_data)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -8,6 +8,22 @@
 
 #include "common/crc16.h"
 
+/**
+ * Reference CRC-CCITT computed bit by bit.
+ */
+static uint16_t reference_crc16(const uint8_t *ptr, size_t count) {
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        crc ^= (uint16_t) ptr[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t) (crc << 1) ^ 0x1021 : (uint16_t) (crc << 1);
+        }
+    }
+
+    return crc;
+}
+
 void test_crc16(void **state) {
     uint8_t input[16] = { 0 };
 
@@ -20,9 +36,43 @@ void test_crc16(void **state) {
     assert_int_equal(output, 20797);
 }
 
+void test_crc16_check_value(void **state) {
+    static const uint8_t input[] = "123456789";
+
+    // CRC-16/XMODEM check value
+    assert_int_equal(crc16(input, sizeof(input) - 1), 0x31c3);
+    assert_int_equal(crc16(input, 0), 0);
+}
+
+void test_crc16_table(void **state) {
+    uint8_t input[256];
+
+    for (int i = 0; i < 256; i++) {
+        input[i] = (uint8_t) (i * 7 + 3);
+        assert_int_equal(CRC16_TABLE[i], reference_crc16(&(uint8_t){i}, 1));
+    }
+    for (size_t len = 0; len <= sizeof(input); len++) {
+        assert_int_equal(crc16(input, len), reference_crc16(input, len));
+    }
+}
+
+void test_crc16_continue(void **state) {
+    static const uint8_t input[] = "123456789";
+
+    // Any split of the data gives the CRC of the whole
+    for (size_t split = 0; split < sizeof(input); split++) {
+        uint16_t crc = crc16_continue(0, input, split);
+        crc = crc16_continue(crc, input + split, sizeof(input) - 1 - split);
+        assert_int_equal(crc, 0x31c3);
+    }
+}
+
 int main() {
     const struct CMUnitTest tests[] = {
-        cmocka_unit_test(test_crc16)
+        cmocka_unit_test(test_crc16),
+        cmocka_unit_test(test_crc16_check_value),
+        cmocka_unit_test(test_crc16_table),
+        cmocka_unit_test(test_crc16_continue)
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,75 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/base64.h"
+#include "common/format_address.h"
+#include "constants.h"
+
+/**
+ * Encode an address with the friendly address then base 64 passes.
+ */
+static void reference_friendly_base64(uint8_t chain,
+                                      const uint8_t *hash,
+                                      bool bounceable,
+                                      bool testOnly,
+                                      char *out,
+                                      size_t out_len) {
+    uint8_t address[ADDRESS_LEN];
+
+    assert_true(address_to_friendly(chain, hash, bounceable, testOnly, address, sizeof(address)));
+    assert_int_equal(base64_encode(address, sizeof(address), out, out_len), FRIENDLY_ADDRESS_LEN);
+}
+
+void test_friendly_base64_vector(void **state) {
+    uint8_t hash[HASH_LEN] = {0};
+    char output[FRIENDLY_ADDRESS_LEN + 1];
+
+    // Zero address of the basechain
+    assert_true(address_to_friendly_base64(0x00, hash, true, false, output, sizeof(output)));
+    assert_string_equal(output, "EQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAM9c");
+}
+
+void test_friendly_base64_flags(void **state) {
+    uint8_t hash[HASH_LEN];
+    char output[FRIENDLY_ADDRESS_LEN + 1];
+    char expected[FRIENDLY_ADDRESS_LEN + 1];
+
+    srand(1);
+    for (int i = 0; i < 1000; i++) {
+        for (size_t j = 0; j < sizeof(hash); j++) {
+            hash[j] = rand();
+        }
+        uint8_t chain = (i & 1) ? 0xff : 0x00;
+        bool bounceable = (i & 2) != 0;
+        bool testOnly = (i & 4) != 0;
+
+        reference_friendly_base64(chain, hash, bounceable, testOnly, expected, sizeof(expected));
+        assert_true(
+            address_to_friendly_base64(chain, hash, bounceable, testOnly, output, sizeof(output)));
+        assert_memory_equal(output, expected, sizeof(expected));
+    }
+}
+
+void test_friendly_base64_out_len(void **state) {
+    uint8_t hash[HASH_LEN] = {0};
+    char output[FRIENDLY_ADDRESS_LEN + 1];
+
+    assert_false(address_to_friendly_base64(0x00, hash, true, false, output, sizeof(output) - 1));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_friendly_base64_vector),
+        cmocka_unit_test(test_friendly_base64_flags),
+        cmocka_unit_test(test_friendly_base64_out_len)
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -4,10 +4,41 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 
 #include <cmocka.h>
 
 #include "common/format_bigint.h"
+#include "common/int256.h"
+
+/**
+ * Reference conversion dividing the whole number of 16-bit limbs by 10 per digit.
+ */
+static void reference_to_decimal(const uint8_t *value, size_t value_len, char *out) {
+    uint8_t bytes[INT256_LENGTH] = {0};
+    uint16_t n[INT256_LENGTH / 2];
+    char digits[INT256_LENGTH * 3];
+    size_t pos = sizeof(digits);
+
+    memcpy(bytes + INT256_LENGTH - value_len, value, value_len);
+    for (size_t i = 0; i < INT256_LENGTH / 2; i++) {
+        n[i] = (uint16_t) ((bytes[2 * i] << 8) | bytes[2 * i + 1]);
+    }
+    do {
+        unsigned int carry = 0;
+        for (size_t i = 0; i < INT256_LENGTH / 2; i++) {
+            unsigned int cur = (carry << 16) | n[i];
+            n[i] = cur / 10;
+            carry = cur % 10;
+        }
+        digits[--pos] = '0' + carry;
+    } while (!allzeroes(n, sizeof(n)));
+
+    memcpy(out, digits + pos, sizeof(digits) - pos);
+    out[sizeof(digits) - pos] = '\0';
+}
 
 void test_with_ticker(void **state) {
     uint8_t input[2] = { 0x01, 0x00 };
@@ -45,11 +76,123 @@ void test_zero(void **state) {
     assert_memory_equal(output, expected, sizeof(expected));
 }
 
-int main() {
+void test_uint256_to_decimal_vectors(void **state) {
+    static const struct {
+        uint8_t value[INT256_LENGTH];
+        size_t value_len;
+        const char *expected;
+    } vectors[] = {
+        {{0x00}, 1, "0"},
+        {{0x00, 0x00, 0x07}, 3, "7"},
+        {{0x27, 0x0f}, 2, "9999"},
+        {{0x27, 0x10}, 2, "10000"},
+        {{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, 8, "18446744073709551615"},
+        {{0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 9, "18446744073709551616"},
+        {{0x05, 0x6b, 0xc7, 0x5e, 0x2d, 0x63, 0x10, 0x00, 0x00}, 9, "100000000000000000000"},
+        {{0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 11,
+         "18446744073709551616"},
+        {{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+          0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+          0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, 32,
+         "115792089237316195423570985008687907853269984665640564039457584007913129639935"},
+    };
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        char output[80];
+
+        assert_true(
+            uint256_to_decimal(vectors[i].value, vectors[i].value_len, output, sizeof(output)));
+        assert_string_equal(output, vectors[i].expected);
+    }
+}
+
+void test_uint256_to_decimal_random(void **state) {
+    uint8_t value[INT256_LENGTH];
+    char output[80];
+    char expected[80];
+
+    srand(1);
+    for (int i = 0; i < 10000; i++) {
+        size_t value_len = 1 + rand() % INT256_LENGTH;
+        for (size_t j = 0; j < value_len; j++) {
+            value[j] = rand();
+        }
+
+        reference_to_decimal(value, value_len, expected);
+        assert_true(uint256_to_decimal(value, value_len, output, sizeof(output)));
+        assert_string_equal(output, expected);
+    }
+}
+
+void test_uint256_to_decimal_out_len(void **state) {
+    uint8_t value[2] = { 0x27, 0x10 };
+    uint8_t too_long[INT256_LENGTH + 1] = { 0 };
+    char output[6];
+
+    // "10000" and the terminating zero
+    assert_true(uint256_to_decimal(value, sizeof(value), output, 6));
+    assert_string_equal(output, "10000");
+    assert_false(uint256_to_decimal(value, sizeof(value), output, 5));
+
+    assert_false(uint256_to_decimal(too_long, sizeof(too_long), output, sizeof(output)));
+    assert_false(uint256_to_decimal(too_long, 1, output, 1));
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * Time conversions of a 64-bit and a 256-bit value with the reference and the
+ * implementation. Not part of the test suite, run manually with:
+ *
+ *   ./build/test_format_bigint bench [iterations]
+ */
+static int bench(unsigned long iterations) {
+    static const size_t lengths[] = { 8, INT256_LENGTH };
+    uint8_t value[INT256_LENGTH];
+    char output[80];
+
+    memset(value, 0xa5, sizeof(value));
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        uint64_t start = now_ns();
+        for (unsigned long j = 0; j < iterations; j++) {
+            value[lengths[i] - 1] = (uint8_t) j;
+            reference_to_decimal(value, lengths[i], output);
+        }
+        uint64_t reference = now_ns() - start;
+
+        start = now_ns();
+        for (unsigned long j = 0; j < iterations; j++) {
+            value[lengths[i] - 1] = (uint8_t) j;
+            uint256_to_decimal(value, lengths[i], output, sizeof(output));
+        }
+        uint64_t elapsed = now_ns() - start;
+
+        printf("uint256_to_decimal/%-3zu %10.1f ns/op (reference %.1f ns/op)\n",
+               lengths[i] * 8,
+               (double) elapsed / (double) iterations,
+               (double) reference / (double) iterations);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        unsigned long iterations = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+        return iterations > 0 ? bench(iterations) : EXIT_FAILURE;
+    }
+
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_with_ticker),
         cmocka_unit_test(test_no_ticker),
-        cmocka_unit_test(test_zero)
+        cmocka_unit_test(test_zero),
+        cmocka_unit_test(test_uint256_to_decimal_vectors),
+        cmocka_unit_test(test_uint256_to_decimal_random),
+        cmocka_unit_test(test_uint256_to_decimal_out_len)
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,125 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/hasher.h"
+
+static void hash_pieces(const uint8_t *data, size_t len, size_t piece_len, uint8_t *out) {
+    hasher_t hasher;
+
+    assert_true(hasher_init(&hasher));
+    for (size_t offset = 0; offset < len; offset += piece_len) {
+        size_t n = len - offset < piece_len ? len - offset : piece_len;
+        assert_true(hasher_update(&hasher, data + offset, n));
+    }
+    assert_true(hasher_final(&hasher, out));
+}
+
+static void test_hasher_vectors(void **state) {
+    (void) state;
+
+    const uint8_t empty_hash[HASH_LEN] = {
+        0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4,
+        0xc8, 0x99, 0x6f, 0xb9, 0x24, 0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b,
+        0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55};
+    const uint8_t abc_hash[HASH_LEN] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40,
+        0xde, 0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17,
+        0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+    const uint8_t two_blocks_hash[HASH_LEN] = {
+        0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26,
+        0x93, 0x0c, 0x3e, 0x60, 0x39, 0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff,
+        0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1};
+    const uint8_t million_hash[HASH_LEN] = {
+        0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7,
+        0xe2, 0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97,
+        0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0};
+    const char *two_blocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    const size_t piece_lens[] = {1, 3, 63, 64, 65, 1000};
+    static uint8_t million[1000000];
+    uint8_t out[HASH_LEN];
+
+    memset(million, 'a', sizeof(million));
+
+    hash_pieces(NULL, 0, 1, out);
+    assert_memory_equal(out, empty_hash, HASH_LEN);
+
+    for (size_t i = 0; i < sizeof(piece_lens) / sizeof(piece_lens[0]); i++) {
+        hash_pieces((const uint8_t *) "abc", 3, piece_lens[i], out);
+        assert_memory_equal(out, abc_hash, HASH_LEN);
+
+        hash_pieces((const uint8_t *) two_blocks, strlen(two_blocks), piece_lens[i], out);
+        assert_memory_equal(out, two_blocks_hash, HASH_LEN);
+
+        hash_pieces(million, sizeof(million), piece_lens[i], out);
+        assert_memory_equal(out, million_hash, HASH_LEN);
+    }
+}
+
+static void test_hasher_splits(void **state) {
+    (void) state;
+
+    uint8_t data[200];
+    uint8_t expected[HASH_LEN];
+    uint8_t out[HASH_LEN];
+    cx_sha256_t sha;
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 7 + 3);
+    }
+    assert_int_equal(cx_sha256_init_no_throw(&sha), CX_OK);
+    assert_int_equal(cx_hash_no_throw((cx_hash_t *) &sha,
+                                      CX_LAST,
+                                      data,
+                                      sizeof(data),
+                                      expected,
+                                      sizeof(expected)),
+                     CX_OK);
+
+    // Any split in three pieces gives the same digest as hashing at once
+    for (size_t a = 0; a <= sizeof(data); a += 5) {
+        for (size_t b = a; b <= sizeof(data); b += 3) {
+            hasher_t hasher;
+            assert_true(hasher_init(&hasher));
+            assert_true(hasher_update(&hasher, data, a));
+            assert_true(hasher_update(&hasher, data + a, b - a));
+            assert_true(hasher_update(&hasher, data + b, sizeof(data) - b));
+            assert_true(hasher_final(&hasher, out));
+            assert_memory_equal(out, expected, HASH_LEN);
+        }
+    }
+}
+
+static void test_hasher_integers(void **state) {
+    (void) state;
+
+    const uint8_t bytes[] = {0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00,
+                             0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11};
+    uint8_t expected[HASH_LEN];
+    uint8_t out[HASH_LEN];
+    hasher_t hasher;
+
+    hash_pieces(bytes, sizeof(bytes), sizeof(bytes), expected);
+
+    assert_true(hasher_init(&hasher));
+    assert_true(hasher_update_be(&hasher, (uint32_t) -1, 4));
+    assert_true(hasher_update_le(&hasher, 42, 4));
+    assert_true(hasher_update_le(&hasher, 0x1122334455667788, 8));
+    assert_true(hasher_final(&hasher, out));
+    assert_memory_equal(out, expected, HASH_LEN);
+
+    assert_false(hasher_update_be(&hasher, 0, 9));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_hasher_vectors),
+                                       cmocka_unit_test(test_hasher_splits),
+                                       cmocka_unit_test(test_hasher_integers)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
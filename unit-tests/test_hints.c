@@ -0,0 +1,148 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/hints.h"
+#include "constants.h"
+
+void test_hints_add_get(void **state) {
+    HintHolder_t hints;
+    Hint_t hint;
+    uint8_t hash[HASH_LEN];
+    uint8_t value[2] = {0x01, 0x00};
+    address_t address = {.chain = 0xff};
+
+    memset(hash, 0xab, sizeof(hash));
+    memset(address.hash, 0xcd, sizeof(address.hash));
+
+    clear_hints(&hints);
+    assert_true(add_hint_text(&hints, "Comment", "Hello", 5));
+    assert_true(add_hint_hash(&hints, "Payload", hash));
+    assert_true(add_hint_hex(&hints, "Key", hash, 4));
+    assert_true(add_hint_amount(&hints, "Amount", "TON", value, sizeof(value), 9));
+    assert_true(add_hint_address(&hints, "Recipient", address, true));
+    assert_true(add_hint_number(&hints, "Query ID", 0x0102030405060708));
+    assert_true(add_hint_bool(&hints, "Forward", true));
+    assert_int_equal(hints.hints_count, 7);
+
+    assert_true(get_hint(&hints, 0, &hint));
+    assert_int_equal(hint.kind, SummaryItemString);
+    assert_string_equal(hint.title, "Comment");
+    assert_int_equal(hint.string.length, 5);
+    assert_memory_equal(hint.string.string, "Hello", 5);
+
+    assert_true(get_hint(&hints, 1, &hint));
+    assert_int_equal(hint.kind, SummaryHash);
+    assert_memory_equal(hint.hash, hash, HASH_LEN);
+
+    assert_true(get_hint(&hints, 2, &hint));
+    assert_int_equal(hint.kind, SummaryHex);
+    assert_int_equal(hint.hex.len, 4);
+    assert_memory_equal(hint.hex.data, hash, 4);
+
+    assert_true(get_hint(&hints, 3, &hint));
+    assert_int_equal(hint.kind, SummaryItemAmount);
+    assert_string_equal(hint.amount.ticker, "TON");
+    assert_int_equal(hint.amount.value_len, sizeof(value));
+    assert_memory_equal(hint.amount.value, value, sizeof(value));
+    assert_int_equal(hint.amount.decimals, 9);
+
+    assert_true(get_hint(&hints, 4, &hint));
+    assert_int_equal(hint.kind, SummaryAddress);
+    assert_string_equal(hint.title, "Recipient");
+    assert_int_equal(hint.address.address.chain, 0xff);
+    assert_memory_equal(hint.address.address.hash, address.hash, HASH_LEN);
+    assert_true(hint.address.bounceable);
+
+    assert_true(get_hint(&hints, 5, &hint));
+    assert_int_equal(hint.kind, SummaryNumber);
+    assert_int_equal(hint.number, 0x0102030405060708);
+
+    assert_true(get_hint(&hints, 6, &hint));
+    assert_int_equal(hint.kind, SummaryBool);
+    assert_true(hint.bool_value);
+
+    assert_false(get_hint(&hints, 7, &hint));
+}
+
+void test_hints_move_truncate(void **state) {
+    HintHolder_t hints;
+    Hint_t hint;
+    uint8_t hash[HASH_LEN] = {0};
+    static const char *titles[] = {"A", "B", "C", "D", "E"};
+
+    // Records of different lengths: text, hash, number, bool, text
+    clear_hints(&hints);
+    assert_true(add_hint_text(&hints, titles[0], "a", 1));
+    assert_true(add_hint_hash(&hints, titles[1], hash));
+    assert_true(add_hint_number(&hints, titles[2], 3));
+    assert_true(add_hint_bool(&hints, titles[3], false));
+    assert_true(add_hint_text(&hints, titles[4], "e", 1));
+    uint16_t data_len = hints.data_len;
+
+    // A B C D E -> A D E B C
+    move_hints_before(&hints, 1, 2);
+    assert_int_equal(hints.data_len, data_len);
+    static const uint8_t order[] = {0, 3, 4, 1, 2};
+    for (uint8_t i = 0; i < sizeof(order); i++) {
+        assert_true(get_hint(&hints, i, &hint));
+        assert_ptr_equal(hint.title, titles[order[i]]);
+    }
+    assert_true(get_hint(&hints, 4, &hint));
+    assert_int_equal(hint.number, 3);
+
+    truncate_hints(&hints, 2);
+    assert_int_equal(hints.hints_count, 2);
+    assert_false(get_hint(&hints, 2, &hint));
+    assert_true(add_hint_number(&hints, "F", 6));
+    assert_true(get_hint(&hints, 2, &hint));
+    assert_string_equal(hint.title, "F");
+    assert_int_equal(hint.number, 6);
+
+    // Truncating past the end changes nothing
+    truncate_hints(&hints, 10);
+    assert_int_equal(hints.hints_count, 3);
+}
+
+void test_hints_full(void **state) {
+    HintHolder_t hints;
+    Hint_t hint;
+    uint8_t hash[HASH_LEN] = {0};
+    uint8_t value[MAX_VALUE_BYTES_LEN + 1] = {0};
+
+    clear_hints(&hints);
+    assert_false(add_hint_hex(&hints, "Hex", hash, HASH_LEN + 1));
+    assert_false(add_hint_amount(&hints, "Amount", "TON", value, sizeof(value), 9));
+    assert_int_equal(hints.hints_count, 0);
+
+    // Records only take the space they need
+    while (hints_fit(&hints, 1)) {
+        assert_true(add_hint_hash(&hints, "Hash", hash));
+    }
+    assert_true(hints.hints_count >= HINTS_ARENA_LEN / HINT_MAX_RECORD_LEN);
+    while (add_hint_bool(&hints, "Bool", true)) {
+    }
+    assert_true(hints.data_len <= HINTS_ARENA_LEN);
+    assert_true(hints.hints_count <= MAX_HINTS);
+    assert_false(add_hint_hash(&hints, "Hash", hash));
+
+    // Full holder is left unchanged
+    uint8_t count = hints.hints_count;
+    assert_false(add_hint_text(&hints, "Text", "text", 4));
+    assert_int_equal(hints.hints_count, count);
+    assert_true(get_hint(&hints, count - 1, &hint));
+    assert_string_equal(hint.title, "Bool");
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_hints_add_get),
+                                       cmocka_unit_test(test_hints_move_truncate),
+                                       cmocka_unit_test(test_hints_full)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,78 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include <cmocka.h>
+
+#include "common/bits.h"
+#include "common/cell.h"
+#include "common/profile.h"
+
+static void sleep_ms(long ms) {
+    struct timespec ts = {.tv_sec = 0, .tv_nsec = ms * 1000000};
+    nanosleep(&ts, NULL);
+}
+
+void test_profile_counters(void **state) {
+    BitString_t bits;
+    CellRef_t refs[2];
+    CellRef_t out;
+
+    profile_reset();
+
+    // Descriptors of an empty cell are staged, the hash is one block
+    BitString_init(&bits);
+    assert_true(hash_Cell(&bits, NULL, 0, &refs[0]));
+    assert_int_equal(G_profile.counters[PROFILE_HASH_CELL], 1);
+    assert_int_equal(G_profile.counters[PROFILE_CX_HASH], 1);
+
+    // Descriptors, depths and hashes of two refs span two blocks
+    refs[1] = refs[0];
+    BitString_init(&bits);
+    assert_true(hash_Cell(&bits, refs, 2, &out));
+    assert_int_equal(G_profile.counters[PROFILE_HASH_CELL], 2);
+    assert_int_equal(G_profile.counters[PROFILE_CX_HASH], 3);
+
+    profile_reset();
+    assert_int_equal(G_profile.counters[PROFILE_HASH_CELL], 0);
+    assert_int_equal(G_profile.counters[PROFILE_CX_HASH], 0);
+}
+
+void test_profile_phases(void **state) {
+    assert_int_equal(PROFILE_TICKS_PER_SECOND, 1000000000);
+
+    profile_reset();
+
+    // Ticks of nested phases are counted in both
+    for (int i = 0; i < 2; i++) {
+        PROFILE_BEGIN(PROFILE_DESERIALIZE);
+        sleep_ms(1);
+        PROFILE_BEGIN(PROFILE_HINTS);
+        sleep_ms(2);
+        PROFILE_END(PROFILE_HINTS);
+        PROFILE_END(PROFILE_DESERIALIZE);
+    }
+
+    assert_int_equal(G_profile.phases[PROFILE_DESERIALIZE].calls, 2);
+    assert_int_equal(G_profile.phases[PROFILE_HINTS].calls, 2);
+    assert_true(G_profile.phases[PROFILE_HINTS].ticks >= 4000000);
+    assert_true(G_profile.phases[PROFILE_DESERIALIZE].ticks >=
+                G_profile.phases[PROFILE_HINTS].ticks + 2000000);
+    assert_int_equal(G_profile.phases[PROFILE_HASH].calls, 0);
+    assert_int_equal(G_profile.phases[PROFILE_HASH].ticks, 0);
+
+    profile_reset();
+    assert_int_equal(G_profile.phases[PROFILE_DESERIALIZE].calls, 0);
+    assert_int_equal(G_profile.phases[PROFILE_DESERIALIZE].ticks, 0);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_profile_counters),
+                                       cmocka_unit_test(test_profile_phases)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,128 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "common/pubkey_cache.h"
+
+static void make_path(uint32_t index, uint32_t path[static 5]) {
+    path[0] = 0x8000002c;
+    path[1] = 0x8000025f;
+    path[2] = 0x80000000;
+    path[3] = 0x80000000;
+    path[4] = 0x80000000 | index;
+}
+
+static void make_key(uint32_t index, uint8_t key[static PUBKEY_LEN]) {
+    memset(key, (uint8_t) (index + 1), PUBKEY_LEN);
+}
+
+static void test_pubkey_cache_find(void **state) {
+    (void) state;
+
+    pubkey_cache_clear();
+
+    uint32_t path[5];
+    uint8_t key[PUBKEY_LEN];
+    uint8_t found[PUBKEY_LEN] = {0};
+
+    make_path(0, path);
+    make_key(0, key);
+    assert_false(pubkey_cache_find(path, 5, found));
+
+    pubkey_cache_add(path, 5, key);
+    assert_true(pubkey_cache_find(path, 5, found));
+    assert_memory_equal(found, key, PUBKEY_LEN);
+
+    // A prefix of a cached path is a different path
+    assert_false(pubkey_cache_find(path, 4, found));
+    assert_false(pubkey_cache_find(path, 0, found));
+
+    pubkey_cache_clear();
+    assert_false(pubkey_cache_find(path, 5, found));
+}
+
+static void test_pubkey_cache_eviction(void **state) {
+    (void) state;
+
+    pubkey_cache_clear();
+
+    uint32_t path[5];
+    uint8_t key[PUBKEY_LEN];
+    uint8_t found[PUBKEY_LEN];
+
+    for (uint32_t i = 0; i < PUBKEY_CACHE_SLOTS; i++) {
+        make_path(i, path);
+        make_key(i, key);
+        pubkey_cache_add(path, 5, key);
+    }
+
+    // Path 0 becomes the most recently used, path 1 is evicted next
+    make_path(0, path);
+    assert_true(pubkey_cache_find(path, 5, found));
+
+    make_path(PUBKEY_CACHE_SLOTS, path);
+    make_key(PUBKEY_CACHE_SLOTS, key);
+    pubkey_cache_add(path, 5, key);
+
+    for (uint32_t i = 0; i <= PUBKEY_CACHE_SLOTS; i++) {
+        make_path(i, path);
+        make_key(i, key);
+        if (i == 1) {
+            assert_false(pubkey_cache_find(path, 5, found));
+        } else {
+            assert_true(pubkey_cache_find(path, 5, found));
+            assert_memory_equal(found, key, PUBKEY_LEN);
+        }
+    }
+}
+
+static void test_pubkey_cache_hash(void **state) {
+    (void) state;
+
+    pubkey_cache_clear();
+
+    uint32_t path[5];
+    uint8_t key[PUBKEY_LEN];
+    uint8_t other[PUBKEY_LEN];
+    uint8_t hash[HASH_LEN];
+    uint8_t found[HASH_LEN] = {0};
+
+    make_path(0, path);
+    make_key(0, key);
+    make_key(1, other);
+    memset(hash, 0xab, sizeof(hash));
+
+    // Hashes are only kept for cached public keys
+    pubkey_cache_add_hash(key, hash);
+    assert_false(pubkey_cache_find_hash(key, found));
+
+    pubkey_cache_add(path, 5, key);
+    assert_false(pubkey_cache_find_hash(key, found));
+    pubkey_cache_add_hash(key, hash);
+    assert_true(pubkey_cache_find_hash(key, found));
+    assert_memory_equal(found, hash, HASH_LEN);
+    assert_false(pubkey_cache_find_hash(other, found));
+
+    // The hash is evicted with its public key
+    for (uint32_t i = 1; i <= PUBKEY_CACHE_SLOTS; i++) {
+        make_path(i, path);
+        make_key(i, other);
+        pubkey_cache_add(path, 5, other);
+    }
+    assert_false(pubkey_cache_find_hash(key, found));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_pubkey_cache_find),
+        cmocka_unit_test(test_pubkey_cache_eviction),
+        cmocka_unit_test(test_pubkey_cache_hash),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
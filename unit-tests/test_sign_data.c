@@ -0,0 +1,174 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "types.h"
+#include "common/buffer.h"
+#include "sign_data/sign_data_deserialize.h"
+
+// Requests and expected cell hashes were generated with an independent
+// implementation of the TON Connect data signature schemas.
+
+static const uint8_t plaintext_request[] = {
+    0x75, 0x4b, 0xf9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x65, 0x53, 0xf1, 0x00,
+    0x53, 0x69, 0x67, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x65,
+    0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x65,
+};
+
+static const uint8_t plaintext_hash[] = {
+    0x5c, 0x40, 0xe1, 0x3c, 0x22, 0x0c, 0x7e, 0xf9, 0xa7, 0xf0, 0xf0, 0xad,
+    0x9a, 0xd3, 0x51, 0x5a, 0x60, 0xac, 0x16, 0x3f, 0x6e, 0xfa, 0xfe, 0x0f,
+    0xd0, 0x0f, 0x42, 0x8a, 0x2a, 0xfc, 0x0a, 0x47,
+};
+
+static const uint8_t long_plaintext_request[] = {
+    0x75, 0x4b, 0xf9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+    0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+    0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,
+    0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x41, 0x42, 0x43, 0x44,
+    0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+};
+
+static const uint8_t long_plaintext_hash[] = {
+    0xc9, 0x35, 0xa3, 0x47, 0xd6, 0x63, 0x38, 0xa7, 0x31, 0x96, 0x6c, 0xf1,
+    0x22, 0x2f, 0xa4, 0x89, 0x7e, 0xd7, 0x2e, 0xd1, 0x53, 0x94, 0xf6, 0x00,
+    0x6f, 0x54, 0x69, 0xe5, 0x93, 0xd3, 0x58, 0x03,
+};
+
+static const uint8_t max_plaintext_hash[] = {
+    0x87, 0x74, 0xda, 0xbb, 0xb1, 0x56, 0xbe, 0x5c, 0x63, 0x76, 0x0d, 0xd4,
+    0x53, 0x86, 0x55, 0xc5, 0x91, 0x79, 0xa4, 0xfc, 0xcc, 0xd5, 0x73, 0x38,
+    0xad, 0x3e, 0xfc, 0x86, 0x76, 0xdf, 0x9a, 0x9a,
+};
+
+static const uint8_t app_data_request[] = {
+    0x54, 0xb5, 0x85, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x01, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6,
+    0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42,
+    0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x0f,
+    0x61, 0x70, 0x70, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x00, 0x00, 0xb4, 0x73, 0xb5, 0xf4, 0x87, 0x83, 0x98,
+    0xa5, 0x95, 0x76, 0xd6, 0xe9, 0xb3, 0xa8, 0x5a, 0x0b, 0x6f, 0xcb, 0x1e,
+    0xbe, 0x7f, 0x2a, 0x43, 0x12, 0xa6, 0x2a, 0x93, 0xd5, 0xdd, 0x43, 0x89,
+    0xdf, 0x00,
+};
+
+static const uint8_t app_data_hash[] = {
+    0xb5, 0x3a, 0x02, 0x46, 0xc2, 0x76, 0xb3, 0x57, 0xba, 0xe3, 0x89, 0x32,
+    0x36, 0x21, 0x7c, 0xc9, 0xad, 0xe8, 0xa3, 0x16, 0xab, 0x07, 0xce, 0x46,
+    0xf5, 0xb6, 0x58, 0xdc, 0x5d, 0x76, 0xd0, 0x0c,
+};
+
+static void check_request(const uint8_t *request,
+                          size_t request_len,
+                          const uint8_t *hash,
+                          uint8_t hints_count) {
+    sign_data_ctx_t ctx;
+    buffer_t buf = {.ptr = request, .size = request_len, .offset = 0};
+
+    memset(&ctx, 0, sizeof(ctx));
+    assert_true(sign_data_deserialize(&buf, &ctx));
+    assert_memory_equal(ctx.cell_hash, hash, HASH_LEN);
+    assert_int_equal(ctx.hints.hints_count, hints_count);
+}
+
+static void test_sign_data_plaintext(void **state) {
+    (void) state;
+
+    check_request(plaintext_request, sizeof(plaintext_request), plaintext_hash, 1);
+    check_request(long_plaintext_request,
+                  sizeof(long_plaintext_request),
+                  long_plaintext_hash,
+                  1);
+}
+
+static void test_sign_data_max_plaintext(void **state) {
+    (void) state;
+
+    uint8_t request[12 + 251];
+    sign_data_ctx_t ctx;
+    buffer_t buf = {.ptr = request, .size = sizeof(request) - 1, .offset = 0};
+
+    // Text of 250 letters spanning the root cell and one more cell
+    memcpy(request, plaintext_request, 12);
+    for (size_t i = 12; i < sizeof(request); i++) {
+        request[i] = 'A' + (i - 12) % 26;
+    }
+    check_request(request, sizeof(request) - 1, max_plaintext_hash, 1);
+
+    // One more letter is too long
+    buf.size = sizeof(request);
+    memset(&ctx, 0, sizeof(ctx));
+    assert_false(sign_data_deserialize(&buf, &ctx));
+}
+
+static void test_sign_data_app_data(void **state) {
+    (void) state;
+
+    check_request(app_data_request, sizeof(app_data_request), app_data_hash, 3);
+}
+
+static void test_sign_data_errors(void **state) {
+    (void) state;
+
+    uint8_t request[sizeof(plaintext_request)];
+    sign_data_ctx_t ctx;
+    buffer_t buf = {.ptr = request, .size = sizeof(request), .offset = 0};
+
+    // Unknown schema
+    memcpy(request, plaintext_request, sizeof(request));
+    request[0] ^= 0xff;
+    memset(&ctx, 0, sizeof(ctx));
+    assert_false(sign_data_deserialize(&buf, &ctx));
+
+    // Non-ASCII text
+    memcpy(request, plaintext_request, sizeof(request));
+    request[sizeof(request) - 1] = 0x80;
+    buf.offset = 0;
+    memset(&ctx, 0, sizeof(ctx));
+    assert_false(sign_data_deserialize(&buf, &ctx));
+}
+
+static void test_sign_data_check_chunk(void **state) {
+    (void) state;
+
+    uint8_t request[sizeof(plaintext_request)];
+
+    // Valid requests split anywhere
+    for (size_t len = 0; len <= sizeof(plaintext_request); len++) {
+        assert_true(sign_data_check_chunk(plaintext_request, len, len / 2));
+    }
+    assert_true(sign_data_check_chunk(app_data_request, sizeof(app_data_request), 0));
+
+    // Unknown schema as soon as it is received
+    memcpy(request, plaintext_request, sizeof(request));
+    request[3] ^= 0xff;
+    assert_false(sign_data_check_chunk(request, 4, 0));
+
+    // Non-ASCII text in the last chunk
+    memcpy(request, plaintext_request, sizeof(request));
+    request[sizeof(request) - 1] = 0x80;
+    assert_true(sign_data_check_chunk(request, sizeof(request) - 1, 0));
+    assert_false(sign_data_check_chunk(request, sizeof(request), sizeof(request) - 1));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_sign_data_plaintext),
+                                       cmocka_unit_test(test_sign_data_max_plaintext),
+                                       cmocka_unit_test(test_sign_data_app_data),
+                                       cmocka_unit_test(test_sign_data_errors),
+                                       cmocka_unit_test(test_sign_data_check_chunk)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
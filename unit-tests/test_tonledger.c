@@ -0,0 +1,104 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "tonledger.h"
+
+#include "tx_vectors.h"
+
+static const uint8_t plaintext_request[] = {
+    0x75, 0x4b, 0xf9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x65, 0x53, 0xf1, 0x00,
+    0x53, 0x69, 0x67, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x65,
+    0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x65,
+};
+
+static const uint8_t plaintext_hash[] = {
+    0x5c, 0x40, 0xe1, 0x3c, 0x22, 0x0c, 0x7e, 0xf9, 0xa7, 0xf0, 0xf0, 0xad,
+    0x9a, 0xd3, 0x51, 0x5a, 0x60, 0xac, 0x16, 0x3f, 0x6e, 0xfa, 0xfe, 0x0f,
+    0xd0, 0x0f, 0x42, 0x8a, 0x2a, 0xfc, 0x0a, 0x47,
+};
+
+static void test_tonledger_transactions(void **state) {
+    (void) state;
+
+    tonledger_request_t *request = tonledger_request_new();
+    uint8_t hash[TONLEDGER_HASH_LEN];
+    char title[32];
+    char value[256];
+
+    assert_non_null(request);
+    assert_int_equal(tonledger_api_version(), TONLEDGER_API_VERSION);
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        const tx_vector_t *v = &vectors[i];
+
+        print_message("%s\n", v->name);
+        assert_int_equal(tonledger_parse_transaction(request, v->request, v->request_len),
+                         TONLEDGER_OK);
+        assert_int_equal(tonledger_parser_status(request), 0);
+        assert_int_equal(tonledger_is_blind(request), v->is_blind);
+        assert_int_equal(tonledger_hints_count(request), v->hints_count);
+        for (size_t j = 0; j < v->hints_count; j++) {
+            assert_int_equal(
+                tonledger_hint(request, j, title, sizeof(title), value, sizeof(value)),
+                TONLEDGER_OK);
+        }
+        assert_int_equal(tonledger_hash(request, hash), TONLEDGER_OK);
+        assert_memory_equal(hash, v->hash, TONLEDGER_HASH_LEN);
+    }
+
+    // Rejected request
+    assert_int_equal(tonledger_parse_transaction(request, comment_request, 5),
+                     TONLEDGER_ERR_TX_PARSING);
+    assert_true(tonledger_parser_status(request) < 0);
+    assert_int_equal(tonledger_hash(request, hash), TONLEDGER_ERR_ARGUMENT);
+    assert_int_equal(tonledger_hints_count(request), 0);
+
+    tonledger_request_free(request);
+}
+
+static void test_tonledger_sign_data(void **state) {
+    (void) state;
+
+    tonledger_request_t *request = tonledger_request_new();
+    uint8_t long_request[600] = {0};
+    uint8_t hash[TONLEDGER_HASH_LEN];
+    char title[32];
+    char value[256];
+
+    assert_int_equal(
+        tonledger_parse_sign_data(request, plaintext_request, sizeof(plaintext_request)),
+        TONLEDGER_OK);
+    assert_int_equal(tonledger_hash(request, hash), TONLEDGER_OK);
+    assert_memory_equal(hash, plaintext_hash, TONLEDGER_HASH_LEN);
+    assert_false(tonledger_is_blind(request));
+    assert_int_equal(tonledger_hints_count(request), 1);
+    assert_int_equal(tonledger_hint(request, 0, title, sizeof(title), value, sizeof(value)),
+                     TONLEDGER_OK);
+    assert_string_equal(title, "Text");
+    assert_string_equal(value, "Sign this message please");
+    assert_int_equal(tonledger_hint(request, 1, title, sizeof(title), value, sizeof(value)),
+                     TONLEDGER_ERR_ARGUMENT);
+
+    // Rejected requests
+    assert_int_equal(tonledger_parse_sign_data(request, long_request, sizeof(long_request)),
+                     TONLEDGER_ERR_DATA_LENGTH);
+    assert_int_equal(tonledger_parse_sign_data(request, long_request, 16),
+                     TONLEDGER_ERR_DATA_PARSING);
+    assert_int_equal(tonledger_hints_count(request), 0);
+
+    assert_int_equal(tonledger_parse_transaction(NULL, NULL, 0), TONLEDGER_ERR_ARGUMENT);
+    tonledger_request_free(request);
+    tonledger_request_free(NULL);
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_tonledger_transactions),
+                                       cmocka_unit_test(test_tonledger_sign_data)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
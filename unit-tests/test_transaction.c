@@ -0,0 +1,450 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "types.h"
+#include "common/buffer.h"
+#include "transaction/deserialize.h"
+#include "transaction/hash.h"
+#include "transaction/highload.h"
+#include "transaction/out_list.h"
+#include "transaction/request.h"
+#include "transaction/w5.h"
+#include "transaction/types.h"
+
+#include "tx_vectors.h"
+#include "highload_vectors.h"
+#include "w5_vectors.h"
+
+static Hint_t hint_at(const HintHolder_t *hints, uint8_t index) {
+    Hint_t hint;
+
+    assert_true(get_hint(hints, index, &hint));
+
+    return hint;
+}
+
+static void test_transaction_vectors(void **state) {
+    (void) state;
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        const tx_vector_t *v = &vectors[i];
+        transaction_ctx_t ctx;
+        buffer_t buf = {.ptr = v->request, .size = v->request_len, .offset = 0};
+
+        memset(&ctx, 0, sizeof(ctx));
+        print_message("%s\n", v->name);
+        assert_int_equal(transaction_deserialize(&buf, &ctx.transaction), PARSING_OK);
+        assert_int_equal(ctx.transaction.is_blind, v->is_blind);
+        assert_int_equal(ctx.transaction.hints.hints_count, v->hints_count);
+        assert_string_equal(ctx.transaction.title, v->title);
+
+        assert_true(hash_tx(&ctx));
+        assert_memory_equal(ctx.m_hash, v->hash, HASH_LEN);
+    }
+}
+
+static void test_transaction_errors(void **state) {
+    (void) state;
+
+    uint8_t request[sizeof(comment_request) + 1];
+    transaction_t tx;
+    buffer_t buf = {.ptr = request, .size = sizeof(comment_request), .offset = 0};
+
+    // Unknown tag
+    memcpy(request, comment_request, sizeof(comment_request));
+    request[0] = 0x7f;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), TAG_PARSING_ERROR);
+
+    // Hints do not match the payload
+    memcpy(request, comment_request, sizeof(comment_request));
+    request[sizeof(comment_request) - 1] ^= 0x01;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), HINTS_PARSING_ERROR);
+
+    // Trailing data
+    memcpy(request, comment_request, sizeof(comment_request));
+    request[sizeof(comment_request)] = 0x00;
+    buf.size = sizeof(request);
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), WRONG_LENGTH_ERROR);
+
+    // Truncated request
+    buf.size = sizeof(comment_request) - 1;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_not_equal(transaction_deserialize(&buf, &tx), PARSING_OK);
+}
+
+static void test_transaction_inline_forward_payload(void **state) {
+    (void) state;
+
+    transaction_t tx;
+    buffer_t buf = {.ptr = jetton_boc_inline_empty_request,
+                    .size = sizeof(jetton_boc_inline_empty_request),
+                    .offset = 0};
+
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), PARSING_OK);
+    assert_false(tx.is_blind);
+    assert_int_equal(tx.hints.hints_count, 2);
+
+    // Inline data which is not displayed needs blind signing
+    buf.ptr = jetton_boc_inline_payload_request;
+    buf.size = sizeof(jetton_boc_inline_payload_request);
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), PARSING_OK);
+    assert_true(tx.is_blind);
+    assert_int_equal(tx.hints.hints_count, 0);
+
+    // Inline references are not displayed either
+    buf.ptr = jetton_boc_inline_ref_request;
+    buf.size = sizeof(jetton_boc_inline_ref_request);
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), PARSING_OK);
+    assert_true(tx.is_blind);
+    assert_int_equal(tx.hints.hints_count, 0);
+}
+
+static void test_transaction_messages(void **state) {
+    (void) state;
+
+    uint8_t request[sizeof(multi_jetton_request)];
+    transaction_t tx;
+    buffer_t buf = {.ptr = request, .size = sizeof(request), .offset = 0};
+
+    // Message fields are displayed in front of the hints of each message
+    memcpy(request, multi_jetton_request, sizeof(request));
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), PARSING_OK);
+    assert_int_equal(tx.messages_count, 2);
+    assert_string_equal(hint_at(&tx.hints, 0).title, "Message 1");
+    assert_string_equal(hint_at(&tx.hints, 0).string.string, "Transfer jetton");
+    assert_string_equal(hint_at(&tx.hints, 1).title, "Amount");
+    assert_string_equal(hint_at(&tx.hints, 2).title, "Jetton wallet");
+    assert_string_equal(hint_at(&tx.hints, 3).title, "Jetton units");
+    assert_string_equal(hint_at(&tx.hints, 5).title, "Message 2");
+    assert_int_equal(hint_at(&tx.hints, 6).kind, SummaryItemString);
+    assert_string_equal(hint_at(&tx.hints, 8).title, "Comment");
+
+    // No messages
+    const size_t count_offset = 1 + 4 + 1 + 4 + 4;
+    request[count_offset] = 0;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), MESSAGES_PARSING_ERROR);
+
+    // Too many messages
+    request[count_offset] = MAX_MESSAGES + 1;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(transaction_deserialize(&buf, &tx), MESSAGES_PARSING_ERROR);
+
+    // More messages than sent
+    request[count_offset] = 3;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_not_equal(transaction_deserialize(&buf, &tx), PARSING_OK);
+}
+
+static void test_transaction_highload(void **state) {
+    (void) state;
+
+    transaction_ctx_t ctx;
+    transaction_t *tx = &ctx.transaction;
+    buffer_t buf;
+
+    // Header and first action in one chunk, then one action per chunk
+    uint8_t chunk[sizeof(highload_header) + sizeof(highload_action_0)];
+    memcpy(chunk, highload_header, sizeof(highload_header));
+    memcpy(chunk + sizeof(highload_header), highload_action_0, sizeof(highload_action_0));
+
+    memset(&ctx, 0, sizeof(ctx));
+    buf = (buffer_t){.ptr = chunk, .size = sizeof(chunk), .offset = 0};
+    assert_int_equal(highload_deserialize_header(&buf, tx), PARSING_OK);
+    assert_int_equal(out_list_deserialize(&buf, tx), PARSING_OK);
+    assert_int_equal(highload_finalize(tx), MESSAGES_PARSING_ERROR);
+    buf = (buffer_t){.ptr = highload_action_1, .size = sizeof(highload_action_1), .offset = 0};
+    assert_int_equal(out_list_deserialize(&buf, tx), PARSING_OK);
+    buf = (buffer_t){.ptr = highload_action_2, .size = sizeof(highload_action_2), .offset = 0};
+    assert_int_equal(out_list_deserialize(&buf, tx), PARSING_OK);
+    assert_int_equal(highload_finalize(tx), PARSING_OK);
+
+    assert_true(tx->is_blind);
+    assert_int_equal(tx->hints.hints_count, 6 + 3 * 2);
+    assert_string_equal(tx->title, "Send 3 messages");
+    assert_string_equal(hint_at(&tx->hints, 0).title, "Messages");
+    assert_string_equal(hint_at(&tx->hints, 1).title, "Total amount");
+    assert_string_equal(hint_at(&tx->hints, 4).title, "Transfer amount");
+    assert_int_equal(hint_at(&tx->hints, 4).amount.value_len, 4);
+    assert_string_equal(hint_at(&tx->hints, 5).title, "Transfer mode");
+    assert_int_equal(hint_at(&tx->hints, 5).number, 3);
+    assert_string_equal(hint_at(&tx->hints, 6).title, "Recipient");
+    assert_true(hash_highload(&ctx));
+    assert_memory_equal(ctx.m_hash, highload_hash, HASH_LEN);
+
+    // Actions beyond the announced count
+    buf = (buffer_t){.ptr = highload_action_0, .size = sizeof(highload_action_0), .offset = 0};
+    assert_int_equal(out_list_deserialize(&buf, tx), MESSAGES_PARSING_ERROR);
+
+    // Recipients which do not fit in the hints force blind signing
+    memset(&ctx, 0, sizeof(ctx));
+    buf = (buffer_t){.ptr = highload_many_header, .size = sizeof(highload_many_header)};
+    assert_int_equal(highload_deserialize_header(&buf, tx), PARSING_OK);
+    buf = (buffer_t){.ptr = highload_many_actions, .size = sizeof(highload_many_actions)};
+    assert_int_equal(out_list_deserialize(&buf, tx), PARSING_OK);
+    assert_int_equal(highload_finalize(tx), PARSING_OK);
+    assert_true(tx->is_blind);
+    assert_true(tx->hints.hints_count <= MAX_HINTS);
+    assert_string_equal(hint_at(&tx->hints, 2).title, "Recipients not shown");
+    assert_true(hash_highload(&ctx));
+    assert_memory_equal(ctx.m_hash, highload_many_hash, HASH_LEN);
+
+    // Wrong tag
+    memcpy(chunk, highload_header, sizeof(highload_header));
+    chunk[0] = 0x00;
+    buf = (buffer_t){.ptr = chunk, .size = sizeof(chunk), .offset = 0};
+    assert_int_equal(highload_deserialize_header(&buf, tx), TAG_PARSING_ERROR);
+}
+
+static void test_transaction_w5(void **state) {
+    (void) state;
+
+    for (size_t i = 0; i < sizeof(w5_vectors) / sizeof(w5_vectors[0]); i++) {
+        const w5_vector_t *v = &w5_vectors[i];
+        transaction_ctx_t ctx;
+        buffer_t buf = {.ptr = v->request, .size = v->request_len, .offset = 0};
+
+        memset(&ctx, 0, sizeof(ctx));
+        print_message("%s\n", v->name);
+        assert_int_equal(w5_deserialize_header(&buf, &ctx.transaction), PARSING_OK);
+        assert_int_equal(out_list_deserialize(&buf, &ctx.transaction), PARSING_OK);
+        assert_int_equal(w5_finalize(&ctx.transaction), PARSING_OK);
+        assert_int_equal(ctx.transaction.is_blind, v->is_blind);
+        assert_string_equal(ctx.transaction.title, v->title);
+
+        assert_true(hash_w5(&ctx));
+        assert_memory_equal(ctx.m_hash, v->hash, HASH_LEN);
+    }
+
+    transaction_t tx;
+    uint8_t request[sizeof(w5_extensions_request)];
+    buffer_t buf = {.ptr = request, .size = sizeof(request), .offset = 0};
+
+    // Extended actions are displayed in front of the wallet id
+    memcpy(request, w5_extensions_request, sizeof(request));
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(w5_deserialize_header(&buf, &tx), PARSING_OK);
+    assert_int_equal(w5_finalize(&tx), PARSING_OK);
+    assert_int_equal(tx.hints.hints_count, 4);
+    assert_string_equal(hint_at(&tx.hints, 0).title, "Add extension");
+    assert_string_equal(hint_at(&tx.hints, 1).title, "Remove extension");
+    assert_string_equal(hint_at(&tx.hints, 2).title, "Signature auth");
+    assert_string_equal(hint_at(&tx.hints, 3).title, "Wallet ID");
+
+    // Unknown extended action
+    const size_t extended_offset = 1 + 4 + 4 + 4 + 1;
+    request[extended_offset] = 0x05;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(w5_deserialize_header(&buf, &tx), MESSAGES_PARSING_ERROR);
+
+    // Too many extended actions
+    request[extended_offset - 1] = W5_MAX_EXTENDED_ACTIONS + 1;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(w5_deserialize_header(&buf, &tx), MESSAGES_PARSING_ERROR);
+
+    // No actions at all
+    request[extended_offset - 1] = 0;
+    request[extended_offset] = 0;
+    buf.offset = 0;
+    memset(&tx, 0, sizeof(tx));
+    assert_int_equal(w5_deserialize_header(&buf, &tx), MESSAGES_PARSING_ERROR);
+}
+
+static void test_transaction_chunks(void **state) {
+    (void) state;
+
+    const size_t chunk_lens[] = {1, 7, 64};
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        for (size_t j = 0; j < sizeof(chunk_lens) / sizeof(chunk_lens[0]); j++) {
+            const tx_vector_t *v = &vectors[i];
+            transaction_ctx_t ctx;
+
+            memset(&ctx, 0, sizeof(ctx));
+            transaction_deserialize_init(&ctx.transaction);
+            for (size_t offset = 0; offset < v->request_len; offset += chunk_lens[j]) {
+                size_t len = v->request_len - offset;
+                if (len > chunk_lens[j]) {
+                    len = chunk_lens[j];
+                }
+                buffer_t buf = {.ptr = v->request + offset, .size = len, .offset = 0};
+                assert_int_equal(transaction_deserialize_chunk(&buf, &ctx.transaction), PARSING_OK);
+                assert_int_equal(buf.offset, len);
+            }
+            assert_int_equal(transaction_deserialize_finish(&ctx.transaction), PARSING_OK);
+            assert_int_equal(ctx.transaction.is_blind, v->is_blind);
+            assert_int_equal(ctx.transaction.hints.hints_count, v->hints_count);
+            assert_string_equal(ctx.transaction.title, v->title);
+
+            assert_true(hash_tx(&ctx));
+            assert_memory_equal(ctx.m_hash, v->hash, HASH_LEN);
+        }
+    }
+
+    // Actions of streamed orders may also be split between chunks
+    transaction_ctx_t ctx;
+    buffer_t buf = {.ptr = highload_many_header, .size = sizeof(highload_many_header), .offset = 0};
+
+    memset(&ctx, 0, sizeof(ctx));
+    assert_int_equal(highload_deserialize_header(&buf, &ctx.transaction), PARSING_OK);
+    for (size_t offset = 0; offset < sizeof(highload_many_actions); offset += 5) {
+        size_t len = sizeof(highload_many_actions) - offset;
+        if (len > 5) {
+            len = 5;
+        }
+        buf = (buffer_t){.ptr = highload_many_actions + offset, .size = len, .offset = 0};
+        assert_int_equal(out_list_deserialize(&buf, &ctx.transaction), PARSING_OK);
+    }
+    assert_int_equal(highload_finalize(&ctx.transaction), PARSING_OK);
+    assert_true(hash_highload(&ctx));
+    assert_memory_equal(ctx.m_hash, highload_many_hash, HASH_LEN);
+
+    // Incomplete request
+    memset(&ctx, 0, sizeof(ctx));
+    transaction_deserialize_init(&ctx.transaction);
+    buf = (buffer_t){.ptr = transfer_request, .size = sizeof(transfer_request) - 1, .offset = 0};
+    assert_int_equal(transaction_deserialize_chunk(&buf, &ctx.transaction), PARSING_OK);
+    assert_int_equal(transaction_deserialize_finish(&ctx.transaction), WRONG_LENGTH_ERROR);
+}
+
+/**
+ * Feed a request to the parser of its tag in chunks of chunk_len bytes and hash it.
+ */
+static void feed_request(transaction_ctx_t *ctx,
+                         const uint8_t *request,
+                         size_t request_len,
+                         size_t chunk_len) {
+    memset(ctx, 0, sizeof(*ctx));
+    transaction_deserialize_init(&ctx->transaction);
+    for (size_t offset = 0; offset < request_len; offset += chunk_len) {
+        size_t len = request_len - offset;
+        if (len > chunk_len) {
+            len = chunk_len;
+        }
+        buffer_t buf = {.ptr = request + offset, .size = len, .offset = 0};
+        bool last = offset + len == request_len;
+        assert_int_equal(request_deserialize_chunk(&buf, &ctx->transaction, last), PARSING_OK);
+    }
+    assert_true(request_hash(ctx));
+}
+
+static void test_transaction_requests(void **state) {
+    (void) state;
+
+    transaction_ctx_t ctx;
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        feed_request(&ctx, vectors[i].request, vectors[i].request_len, 16);
+        assert_memory_equal(ctx.m_hash, vectors[i].hash, HASH_LEN);
+    }
+
+    // Headers of streamed orders are sent in the first chunk
+    for (size_t i = 0; i < sizeof(w5_vectors) / sizeof(w5_vectors[0]); i++) {
+        feed_request(&ctx, w5_vectors[i].request, w5_vectors[i].request_len, 255);
+        assert_memory_equal(ctx.m_hash, w5_vectors[i].hash, HASH_LEN);
+    }
+
+    uint8_t request[sizeof(highload_many_header) + sizeof(highload_many_actions)];
+    memcpy(request, highload_many_header, sizeof(highload_many_header));
+    memcpy(request + sizeof(highload_many_header),
+           highload_many_actions,
+           sizeof(highload_many_actions));
+    feed_request(&ctx, request, sizeof(request), 255);
+    assert_memory_equal(ctx.m_hash, highload_many_hash, HASH_LEN);
+}
+
+static void test_transaction_sent_amount(void **state) {
+    (void) state;
+
+    transaction_t tx;
+    uint64_t amount;
+
+    // Values of the messages of an order
+    memset(&tx, 0, sizeof(tx));
+    tx.messages_count = 2;
+    tx.messages[0].value_buf[0] = 0x01;
+    tx.messages[0].value_buf[1] = 0x00;
+    tx.messages[0].value_len = 2;
+    tx.messages[1].value_buf[0] = 0x05;
+    tx.messages[1].value_len = 1;
+    assert_true(request_sent_amount(&tx, &amount));
+    assert_int_equal(amount, 261);
+
+    // Whole balance
+    tx.messages[1].send_mode = 128;
+    assert_false(request_sent_amount(&tx, &amount));
+
+    // Values which do not fit in 64 bits
+    tx.messages[1].send_mode = 3;
+    memset(tx.messages[0].value_buf, 0xff, 8);
+    tx.messages[0].value_len = 8;
+    assert_false(request_sent_amount(&tx, &amount));
+    tx.messages[0].value_buf[8] = 0x00;
+    tx.messages[0].value_len = 9;
+    assert_false(request_sent_amount(&tx, &amount));
+
+    // Total of the send actions of a streamed order
+    memset(&tx, 0, sizeof(tx));
+    tx.tag = W5_TAG;
+    tx.out_list.total[MAX_VALUE_BYTES_LEN - 1] = 7;
+    assert_true(request_sent_amount(&tx, &amount));
+    assert_int_equal(amount, 7);
+    tx.out_list.total_all = true;
+    assert_false(request_sent_amount(&tx, &amount));
+
+    // Extended actions of a wallet v5
+    tx.out_list.total_all = false;
+    tx.w5.extended_count = 1;
+    tx.w5.extended[0].op = W5_ACTION_ADD_EXTENSION;
+    assert_false(request_sent_amount(&tx, &amount));
+
+    // Value of the internal_transfer of a highload order
+    memset(&tx, 0, sizeof(tx));
+    tx.tag = HIGHLOAD_TAG;
+    tx.out_list.total[MAX_VALUE_BYTES_LEN - 1] = 7;
+    tx.highload.transfer.value_buf[0] = 0x02;
+    tx.highload.transfer.value_buf[1] = 0x00;
+    tx.highload.transfer.value_len = 2;
+    tx.highload.transfer.send_mode = 3;
+    assert_true(request_sent_amount(&tx, &amount));
+    assert_int_equal(amount, 519);
+    tx.highload.transfer.send_mode = 128;
+    assert_false(request_sent_amount(&tx, &amount));
+}
+
+int main() {
+    const struct CMUnitTest tests[] = {cmocka_unit_test(test_transaction_vectors),
+                                       cmocka_unit_test(test_transaction_errors),
+                                       cmocka_unit_test(test_transaction_inline_forward_payload),
+                                       cmocka_unit_test(test_transaction_messages),
+                                       cmocka_unit_test(test_transaction_highload),
+                                       cmocka_unit_test(test_transaction_w5),
+                                       cmocka_unit_test(test_transaction_chunks),
+                                       cmocka_unit_test(test_transaction_requests),
+                                       cmocka_unit_test(test_transaction_sent_amount)};
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
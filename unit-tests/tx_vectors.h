@@ -0,0 +1,533 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Requests and expected order hashes were generated with an independent
+// implementation of the v4r2 order serialization.
+
+static const uint8_t transfer_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x81, 0x01, 0x00, 0x04, 0x05, 0xf5,
+    0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x03, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t transfer_hash[] = {
+    0xc6, 0x3f, 0xde, 0x4a, 0xd6, 0x19, 0x2e, 0x96, 0xb2, 0x40, 0xe9, 0x9e,
+    0x70, 0x56, 0x0d, 0x2f, 0x8c, 0xf1, 0x2d, 0xfe, 0x6d, 0xcb, 0x9a, 0x4a,
+    0x78, 0xb6, 0x3f, 0x9f, 0x26, 0xed, 0x08, 0xfb,
+};
+
+static const uint8_t comment_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x53, 0xf1, 0x00, 0x06, 0x01, 0x1f,
+    0x71, 0xfb, 0x04, 0xcb, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1,
+    0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f,
+    0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb,
+    0xec, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x05, 0x12, 0x09, 0xe2,
+    0x56, 0x91, 0x67, 0x22, 0xd7, 0x65, 0x84, 0x4c, 0xe0, 0x61, 0xdc, 0x6a,
+    0xd1, 0x8f, 0x35, 0x91, 0x46, 0x5b, 0x0c, 0x60, 0xc7, 0x03, 0xe8, 0xcf,
+    0x8c, 0x32, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x48, 0x65,
+    0x6c, 0x6c, 0x6f, 0x2c, 0x20, 0x54, 0x4f, 0x4e, 0x21,
+};
+
+static const uint8_t comment_hash[] = {
+    0xc5, 0x62, 0x74, 0x6f, 0x3a, 0x54, 0x1a, 0xff, 0x04, 0xb2, 0xc1, 0x91,
+    0xfe, 0x58, 0x60, 0xf7, 0xa7, 0x8b, 0x3e, 0x73, 0xad, 0x6d, 0x0b, 0xd4,
+    0x75, 0x9b, 0xda, 0xff, 0x87, 0x05, 0xda, 0xe7,
+};
+
+static const uint8_t jetton_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x5c, 0x94, 0x20, 0x1c, 0x16, 0xb4, 0x9a,
+    0xd0, 0xb8, 0xb3, 0xba, 0x4a, 0xb8, 0x4f, 0xf1, 0xc1, 0x4e, 0xea, 0x71,
+    0xf1, 0x94, 0x1d, 0x8c, 0xb1, 0x4a, 0x34, 0xe9, 0x15, 0x3b, 0x37, 0xd0,
+    0x81, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x03, 0x0f, 0x42, 0x40, 0xff, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2,
+    0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd,
+    0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9,
+    0xca, 0xdb, 0xec, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x32, 0x81, 0x40,
+    0x77, 0x27, 0xd3, 0x21, 0x4a, 0x15, 0xbc, 0x84, 0x80, 0xcf, 0xc2, 0x58,
+    0xf7, 0x54, 0x78, 0xfe, 0x94, 0xc3, 0x6f, 0x16, 0x51, 0x26, 0xc0, 0xca,
+    0xb3, 0x2b, 0x88, 0x11, 0x39,
+};
+
+static const uint8_t jetton_hash[] = {
+    0x7d, 0x3d, 0x2d, 0xc0, 0xd3, 0x5d, 0xec, 0x29, 0x22, 0xf5, 0x4a, 0x49,
+    0x03, 0x59, 0xb0, 0x3e, 0xa3, 0xea, 0x8f, 0x2c, 0xc8, 0x9d, 0xac, 0x61,
+    0x34, 0x32, 0x07, 0xd9, 0xc1, 0x99, 0x36, 0xb3,
+};
+
+static const uint8_t blind_state_init_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x53, 0xf1, 0x00, 0x01, 0x01, 0x00,
+    0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8,
+    0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64,
+    0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03, 0x01, 0x00,
+    0x08, 0x19, 0x64, 0xc1, 0x3a, 0x39, 0xac, 0xe0, 0x60, 0x88, 0x01, 0x0a,
+    0x68, 0x7d, 0x6c, 0x87, 0xb8, 0xaa, 0x26, 0xf7, 0xb2, 0x92, 0xf8, 0xdc,
+    0xd9, 0x3c, 0x1a, 0x98, 0x16, 0x5d, 0xce, 0x72, 0x8b, 0x01, 0x00, 0x01,
+    0xe4, 0x73, 0xae, 0xf4, 0xdd, 0x06, 0x28, 0x7f, 0xdd, 0xb8, 0x48, 0x73,
+    0xfa, 0x21, 0xe6, 0x6c, 0xfb, 0x40, 0x3b, 0x85, 0x7b, 0x4e, 0x6a, 0x0e,
+    0xf9, 0x6f, 0x0d, 0xad, 0x2f, 0xa5, 0x92, 0xbf, 0x00,
+};
+
+static const uint8_t blind_state_init_hash[] = {
+    0x5e, 0x28, 0x09, 0xf8, 0xb7, 0x3b, 0xb9, 0x56, 0x2d, 0x45, 0x4e, 0x13,
+    0xda, 0x40, 0xc9, 0x19, 0xf2, 0x90, 0xd2, 0x9e, 0x1a, 0x4b, 0xf5, 0xd6,
+    0x75, 0xe9, 0x92, 0x6a, 0x20, 0x6d, 0xc8, 0x6a,
+};
+
+static const uint8_t subwallet_request[] = {
+    0x01, 0x00, 0x00, 0x04, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x09, 0x65, 0x53,
+    0xf1, 0x00, 0x01, 0x02, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t subwallet_hash[] = {
+    0x7e, 0x27, 0xb1, 0x63, 0x92, 0x2d, 0xa3, 0xd3, 0x59, 0xd5, 0x28, 0xd7,
+    0x9c, 0xc4, 0x1a, 0xf4, 0xa9, 0x25, 0xce, 0x99, 0x1b, 0x5c, 0xba, 0x60,
+    0x42, 0x0e, 0x83, 0x1b, 0x45, 0xd8, 0x71, 0x2d,
+};
+
+static const uint8_t burn_inline_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x53, 0xf1, 0x00, 0x01, 0x03, 0x00,
+    0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8,
+    0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64,
+    0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03, 0x00, 0x01,
+    0x00, 0x01, 0xad, 0xb8, 0xb7, 0x47, 0xdd, 0x32, 0x8c, 0x1c, 0x6d, 0xe4,
+    0xcd, 0xab, 0x5b, 0x57, 0x3f, 0xe3, 0xcf, 0x3a, 0x8a, 0xcd, 0xc2, 0x7b,
+    0x6c, 0x75, 0x5d, 0x51, 0x2f, 0x5b, 0x84, 0x9b, 0x6c, 0x80, 0x01, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x29, 0x00, 0x01, 0x4d, 0x00, 0xe5, 0xd2, 0xc8,
+    0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb,
+    0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97,
+    0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x02, 0x03, 0xaa, 0xbb, 0xcc,
+};
+
+static const uint8_t burn_inline_hash[] = {
+    0x10, 0x9f, 0x4f, 0xf1, 0xb7, 0xc2, 0xf1, 0x63, 0x85, 0x7e, 0x3a, 0x25,
+    0xea, 0xca, 0x4f, 0xa3, 0x12, 0xbe, 0x13, 0x65, 0x6d, 0x31, 0x66, 0xae,
+    0x84, 0x19, 0xe7, 0xf8, 0x64, 0x22, 0x8f, 0x76,
+};
+
+static const uint8_t dns_wallet_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x03, 0x00, 0x01, 0x00, 0x01, 0xf0, 0xbc, 0xe4, 0x9a, 0x6d, 0xf7, 0x0c,
+    0xc1, 0x4b, 0xf4, 0x70, 0x73, 0x8b, 0x1f, 0x25, 0xfc, 0x88, 0xa1, 0x15,
+    0x26, 0x1e, 0x44, 0x73, 0x05, 0x25, 0x68, 0x91, 0xf2, 0xe6, 0x28, 0x79,
+    0xe3, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0xe5, 0xd2, 0xc8, 0xb8,
+    0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec,
+    0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8,
+    0xb9, 0xca, 0xdb, 0xec, 0x01, 0x01,
+};
+
+static const uint8_t dns_wallet_hash[] = {
+    0x11, 0x6b, 0x74, 0x50, 0x2c, 0x9a, 0x77, 0x92, 0xb2, 0x89, 0x59, 0xdd,
+    0x3d, 0x20, 0xdb, 0x46, 0xd4, 0xa5, 0x0c, 0x7e, 0xf4, 0x88, 0x87, 0x26,
+    0xf8, 0xe2, 0x21, 0x05, 0x42, 0x16, 0x95, 0xed,
+};
+
+static const uint8_t dao_vote_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x4f, 0xe9, 0xf1, 0x38, 0xf5, 0x8a,
+    0x30, 0x02, 0xa4, 0x12, 0x21, 0xf2, 0xa0, 0xaf, 0xad, 0x60, 0x65, 0xff,
+    0xb2, 0x60, 0x95, 0x88, 0xfc, 0x0d, 0xb9, 0xd6, 0x4f, 0xa7, 0x35, 0xee,
+    0xc5, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x2a, 0x00, 0xff, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x00, 0x00, 0x6b, 0x49, 0xd2, 0x00,
+    0x01, 0x00,
+};
+
+static const uint8_t dao_vote_hash[] = {
+    0xf8, 0xe9, 0xb6, 0xcb, 0xca, 0xcc, 0x06, 0x7c, 0xee, 0x4e, 0x81, 0xf5,
+    0x24, 0x16, 0x7b, 0x3d, 0x7f, 0x89, 0xe9, 0xc0, 0x5e, 0xc6, 0xa0, 0xd8,
+    0xdb, 0x12, 0x35, 0x11, 0x6d, 0x9a, 0x5a, 0xab,
+};
+
+static const uint8_t jetton_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x01, 0x00, 0x02, 0x00, 0x8d, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x02,
+    0x01, 0x00, 0x00, 0x7d, 0x00, 0x21, 0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0xf4, 0x24, 0x09, 0xfe,
+    0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16,
+    0x18, 0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e,
+    0x30, 0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3f, 0x00, 0x39, 0x74, 0xb2,
+    0x2e, 0x28, 0xbc, 0xec, 0x70, 0x35, 0x39, 0xbd, 0xea, 0x2e, 0x72, 0xb6,
+    0xfb, 0x3f, 0x43, 0x87, 0xc8, 0x0c, 0x50, 0x94, 0xd9, 0x1d, 0x61, 0xa5,
+    0xea, 0x2e, 0x72, 0xb6, 0xfb, 0x02, 0x03, 0x01, 0x28, 0x48, 0x01, 0x01,
+    0x32, 0x81, 0x40, 0x77, 0x27, 0xd3, 0x21, 0x4a, 0x15, 0xbc, 0x84, 0x80,
+    0xcf, 0xc2, 0x58, 0xf7, 0x54, 0x78, 0xfe, 0x94, 0xc3, 0x6f, 0x16, 0x51,
+    0x26, 0xc0, 0xca, 0xb3, 0x2b, 0x88, 0x11, 0x39, 0x00, 0x00, 0xfc, 0x15,
+    0x61, 0x76, 0x00,
+};
+
+static const uint8_t jetton_boc_hash[] = {
+    0x7d, 0x3d, 0x2d, 0xc0, 0xd3, 0x5d, 0xec, 0x29, 0x22, 0xf5, 0x4a, 0x49,
+    0x03, 0x59, 0xb0, 0x3e, 0xa3, 0xea, 0x8f, 0x2c, 0xc8, 0x9d, 0xac, 0x61,
+    0x34, 0x32, 0x07, 0xd9, 0xc1, 0x99, 0x36, 0xb3,
+};
+
+static const uint8_t comment_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x65, 0x53, 0xf1, 0x00, 0x06, 0x01, 0x1f,
+    0x71, 0xfb, 0x04, 0xcb, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1,
+    0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f,
+    0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb,
+    0xec, 0x00, 0x03, 0x00, 0x02, 0x00, 0x21, 0xb5, 0xee, 0x9c, 0x72, 0x41,
+    0x02, 0x01, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20, 0x54, 0x4f, 0x4e, 0x21,
+    0x46, 0xcf, 0x1a, 0xf0, 0x00,
+};
+
+static const uint8_t comment_boc_hash[] = {
+    0xc5, 0x62, 0x74, 0x6f, 0x3a, 0x54, 0x1a, 0xff, 0x04, 0xb2, 0xc1, 0x91,
+    0xfe, 0x58, 0x60, 0xf7, 0xa7, 0x8b, 0x3e, 0x73, 0xad, 0x6d, 0x0b, 0xd4,
+    0x75, 0x9b, 0xda, 0xff, 0x87, 0x05, 0xda, 0xe7,
+};
+
+static const uint8_t nft_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x03, 0x00, 0x02, 0x00, 0x68, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x01,
+    0x01, 0x00, 0x00, 0x58, 0x00, 0x00, 0xab, 0x5f, 0xcc, 0x3d, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1c, 0xba, 0x59, 0x17,
+    0x14, 0x5e, 0x76, 0x38, 0x1a, 0x9c, 0xde, 0xf5, 0x17, 0x39, 0x5b, 0x7d,
+    0x9f, 0xa1, 0xc3, 0xe4, 0x06, 0x28, 0x4a, 0x6c, 0x8e, 0xb0, 0xd2, 0xf5,
+    0x17, 0x39, 0x5b, 0x7d, 0x93, 0xfc, 0x00, 0x04, 0x08, 0x0c, 0x10, 0x14,
+    0x18, 0x1c, 0x20, 0x24, 0x28, 0x2c, 0x30, 0x34, 0x38, 0x3c, 0x40, 0x44,
+    0x48, 0x4c, 0x50, 0x54, 0x58, 0x5c, 0x60, 0x64, 0x68, 0x6c, 0x70, 0x74,
+    0x78, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0xd8, 0xdb, 0xec, 0x30,
+    0xe9, 0x00,
+};
+
+static const uint8_t nft_boc_hash[] = {
+    0x1b, 0x24, 0x03, 0x6a, 0x9c, 0x71, 0xf3, 0x4b, 0xcd, 0xe5, 0x31, 0x58,
+    0xb8, 0x54, 0x87, 0x0b, 0x5e, 0x83, 0x29, 0x77, 0x3e, 0xa2, 0x76, 0xc3,
+    0xcc, 0x8d, 0x3a, 0x36, 0xa9, 0xa5, 0xa6, 0x06,
+};
+
+static const uint8_t unknown_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x53, 0xf1, 0x00, 0x01, 0x01, 0x00,
+    0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8,
+    0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64,
+    0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03, 0x00, 0x02,
+    0x00, 0x1a, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x02, 0x01, 0x00, 0x00,
+    0x0a, 0x00, 0x01, 0x08, 0xde, 0xad, 0xbe, 0xef, 0x01, 0x00, 0x01, 0xc0,
+    0xae, 0x2c, 0x9b, 0x64, 0x00,
+};
+
+static const uint8_t unknown_boc_hash[] = {
+    0x6c, 0x2f, 0x8b, 0x7a, 0xdc, 0xe3, 0xfa, 0x86, 0x0b, 0xbb, 0x61, 0xea,
+    0x7b, 0x51, 0x91, 0x68, 0xa0, 0x5b, 0x3a, 0xa1, 0x63, 0xcf, 0xb9, 0x01,
+    0x54, 0x99, 0x64, 0x33, 0xad, 0x45, 0xf7, 0x3b,
+};
+
+static const uint8_t jetton_boc_hints_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x01, 0x00, 0x02, 0x00, 0x8d, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x02,
+    0x01, 0x00, 0x00, 0x7d, 0x00, 0x21, 0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0xf4, 0x24, 0x09, 0xfe,
+    0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16,
+    0x18, 0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e,
+    0x30, 0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3f, 0x00, 0x39, 0x74, 0xb2,
+    0x2e, 0x28, 0xbc, 0xec, 0x70, 0x35, 0x39, 0xbd, 0xea, 0x2e, 0x72, 0xb6,
+    0xfb, 0x3f, 0x43, 0x87, 0xc8, 0x0c, 0x50, 0x94, 0xd9, 0x1d, 0x61, 0xa5,
+    0xea, 0x2e, 0x72, 0xb6, 0xfb, 0x02, 0x03, 0x01, 0x28, 0x48, 0x01, 0x01,
+    0x32, 0x81, 0x40, 0x77, 0x27, 0xd3, 0x21, 0x4a, 0x15, 0xbc, 0x84, 0x80,
+    0xcf, 0xc2, 0x58, 0xf7, 0x54, 0x78, 0xfe, 0x94, 0xc3, 0x6f, 0x16, 0x51,
+    0x26, 0xc0, 0xca, 0xb3, 0x2b, 0x88, 0x11, 0x39, 0x00, 0x00, 0xfc, 0x15,
+    0x61, 0x76, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x75, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x03, 0x0f, 0x42, 0x40, 0xff, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+    0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x00, 0xe5, 0xd2, 0xc8, 0xb8,
+    0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec,
+    0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8,
+    0xb9, 0xca, 0xdb, 0xec, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x32, 0x81,
+    0x40, 0x77, 0x27, 0xd3, 0x21, 0x4a, 0x15, 0xbc, 0x84, 0x80, 0xcf, 0xc2,
+    0x58, 0xf7, 0x54, 0x78, 0xfe, 0x94, 0xc3, 0x6f, 0x16, 0x51, 0x26, 0xc0,
+    0xca, 0xb3, 0x2b, 0x88, 0x11, 0x39,
+};
+
+static const uint8_t jetton_boc_hints_hash[] = {
+    0x7d, 0x3d, 0x2d, 0xc0, 0xd3, 0x5d, 0xec, 0x29, 0x22, 0xf5, 0x4a, 0x49,
+    0x03, 0x59, 0xb0, 0x3e, 0xa3, 0xea, 0x8f, 0x2c, 0xc8, 0x9d, 0xac, 0x61,
+    0x34, 0x32, 0x07, 0xd9, 0xc1, 0x99, 0x36, 0xb3,
+};
+
+static const uint8_t burn_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x53, 0xf1, 0x00, 0x01, 0x03, 0x00,
+    0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8,
+    0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64,
+    0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03, 0x00, 0x02,
+    0x00, 0x47, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x02, 0x01, 0x00, 0x00,
+    0x37, 0x00, 0x01, 0x5e, 0x59, 0x5f, 0x07, 0xbc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0xd8, 0x01, 0xcb, 0xa5, 0x91, 0x71, 0x45,
+    0xe7, 0x63, 0x81, 0xa9, 0xcd, 0xef, 0x51, 0x73, 0x95, 0xb7, 0xd9, 0xfa,
+    0x1c, 0x3e, 0x40, 0x62, 0x84, 0xa6, 0xc8, 0xeb, 0x0d, 0x2f, 0x51, 0x73,
+    0x95, 0xb7, 0xd9, 0x01, 0x00, 0x06, 0xaa, 0xbb, 0xcc, 0xb0, 0x85, 0x61,
+    0x84, 0x00,
+};
+
+static const uint8_t burn_boc_hash[] = {
+    0x10, 0x9f, 0x4f, 0xf1, 0xb7, 0xc2, 0xf1, 0x63, 0x85, 0x7e, 0x3a, 0x25,
+    0xea, 0xca, 0x4f, 0xa3, 0x12, 0xbe, 0x13, 0x65, 0x6d, 0x31, 0x66, 0xae,
+    0x84, 0x19, 0xe7, 0xf8, 0x64, 0x22, 0x8f, 0x76,
+};
+
+static const uint8_t dao_vote_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x03, 0x00, 0x02, 0x00, 0x46, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x01,
+    0x01, 0x00, 0x00, 0x36, 0x00, 0x00, 0x67, 0x69, 0xfb, 0x30, 0x6c, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0x20, 0x40,
+    0x60, 0x80, 0xa0, 0xc0, 0xe1, 0x01, 0x21, 0x41, 0x61, 0x81, 0xa1, 0xc1,
+    0xe2, 0x02, 0x22, 0x42, 0x62, 0x82, 0xa2, 0xc2, 0xe3, 0x03, 0x23, 0x43,
+    0x63, 0x83, 0xa3, 0xc3, 0xe0, 0x00, 0x0d, 0x69, 0x3a, 0x40, 0x14, 0x6e,
+    0xbd, 0x90, 0xf9, 0x00,
+};
+
+static const uint8_t dao_vote_boc_hash[] = {
+    0xf8, 0xe9, 0xb6, 0xcb, 0xca, 0xcc, 0x06, 0x7c, 0xee, 0x4e, 0x81, 0xf5,
+    0x24, 0x16, 0x7b, 0x3d, 0x7f, 0x89, 0xe9, 0xc0, 0x5e, 0xc6, 0xa0, 0xd8,
+    0xdb, 0x12, 0x35, 0x11, 0x6d, 0x9a, 0x5a, 0xab,
+};
+
+static const uint8_t withdraw_boc_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x3b, 0x9a,
+    0xca, 0x00, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x03, 0x00, 0x02, 0x00, 0x24, 0xb5, 0xee, 0x9c, 0x72, 0x41, 0x02, 0x01,
+    0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x23, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x12, 0xa0, 0x5f, 0x20,
+    0x08, 0xa7, 0x31, 0xb1, 0x7e, 0x00,
+};
+
+static const uint8_t withdraw_boc_hash[] = {
+    0xd5, 0x83, 0x94, 0xca, 0x0a, 0x99, 0x45, 0x53, 0x5f, 0x21, 0x36, 0xcf,
+    0x84, 0x51, 0x68, 0xed, 0x65, 0x59, 0xf9, 0x69, 0x36, 0xcf, 0x57, 0x1b,
+    0x8c, 0xd7, 0x5f, 0x75, 0x73, 0x6e, 0xa8, 0x69,
+};
+
+static const uint8_t multi_blind_request[] = {
+    0x02, 0x29, 0xa9, 0xa3, 0x17, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x65, 0x53,
+    0xf1, 0x00, 0x03, 0x04, 0x05, 0xf5, 0xe1, 0x00, 0x00, 0xe5, 0xd2, 0xc8,
+    0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb,
+    0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97,
+    0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x77,
+    0x35, 0x94, 0x00, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x05, 0x12, 0x09, 0xe2, 0x56,
+    0x91, 0x67, 0x22, 0xd7, 0x65, 0x84, 0x4c, 0xe0, 0x61, 0xdc, 0x6a, 0xd1,
+    0x8f, 0x35, 0x91, 0x46, 0x5b, 0x0c, 0x60, 0xc7, 0x03, 0xe8, 0xcf, 0x8c,
+    0x32, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x48, 0x65, 0x6c,
+    0x6c, 0x6f, 0x2c, 0x20, 0x54, 0x4f, 0x4e, 0x21, 0x01, 0x01, 0x00, 0xe5,
+    0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9,
+    0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75,
+    0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0xe4, 0x73, 0xae, 0xf4, 0xdd, 0x06, 0x28, 0x7f, 0xdd, 0xb8, 0x48,
+    0x73, 0xfa, 0x21, 0xe6, 0x6c, 0xfb, 0x40, 0x3b, 0x85, 0x7b, 0x4e, 0x6a,
+    0x0e, 0xf9, 0x6f, 0x0d, 0xad, 0x2f, 0xa5, 0x92, 0xbf, 0x00,
+};
+
+static const uint8_t multi_blind_hash[] = {
+    0x8e, 0x66, 0x47, 0x81, 0xee, 0xaa, 0x58, 0xda, 0xa2, 0x44, 0x66, 0x9c,
+    0x23, 0x77, 0xff, 0x9c, 0x68, 0xbb, 0xfa, 0x1d, 0xf2, 0x59, 0xc9, 0x8e,
+    0x03, 0x4f, 0x24, 0xee, 0x48, 0x73, 0x66, 0x47,
+};
+
+static const uint8_t multi_jetton_request[] = {
+    0x02, 0x29, 0xa9, 0xa3, 0x17, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x65, 0x53,
+    0xf1, 0x00, 0x02, 0x04, 0x02, 0xfa, 0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8,
+    0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb,
+    0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97,
+    0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x01, 0x00, 0x02, 0x00, 0x8d, 0xb5,
+    0xee, 0x9c, 0x72, 0x41, 0x02, 0x02, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x21,
+    0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0x30, 0xf4, 0x24, 0x09, 0xfe, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0a,
+    0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e, 0x20, 0x22,
+    0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30, 0x32, 0x34, 0x36, 0x38, 0x3a,
+    0x3c, 0x3f, 0x00, 0x39, 0x74, 0xb2, 0x2e, 0x28, 0xbc, 0xec, 0x70, 0x35,
+    0x39, 0xbd, 0xea, 0x2e, 0x72, 0xb6, 0xfb, 0x3f, 0x43, 0x87, 0xc8, 0x0c,
+    0x50, 0x94, 0xd9, 0x1d, 0x61, 0xa5, 0xea, 0x2e, 0x72, 0xb6, 0xfb, 0x02,
+    0x03, 0x01, 0x28, 0x48, 0x01, 0x01, 0x32, 0x81, 0x40, 0x77, 0x27, 0xd3,
+    0x21, 0x4a, 0x15, 0xbc, 0x84, 0x80, 0xcf, 0xc2, 0x58, 0xf7, 0x54, 0x78,
+    0xfe, 0x94, 0xc3, 0x6f, 0x16, 0x51, 0x26, 0xc0, 0xca, 0xb3, 0x2b, 0x88,
+    0x11, 0x39, 0x00, 0x00, 0xfc, 0x15, 0x61, 0x76, 0x00, 0x01, 0x07, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x01, 0x80, 0x00, 0x01,
+    0x00, 0x00, 0x02, 0x05, 0x12, 0x09, 0xe2, 0x56, 0x91, 0x67, 0x22, 0xd7,
+    0x65, 0x84, 0x4c, 0xe0, 0x61, 0xdc, 0x6a, 0xd1, 0x8f, 0x35, 0x91, 0x46,
+    0x5b, 0x0c, 0x60, 0xc7, 0x03, 0xe8, 0xcf, 0x8c, 0x32, 0x5e, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20,
+    0x54, 0x4f, 0x4e, 0x21,
+};
+
+static const uint8_t multi_jetton_hash[] = {
+    0x2d, 0x30, 0x08, 0x24, 0x69, 0x3c, 0x7c, 0xd7, 0xcc, 0x01, 0x99, 0xfc,
+    0x2c, 0x90, 0x58, 0xd6, 0xaf, 0x74, 0x7d, 0xd9, 0x04, 0xb0, 0x66, 0xd4,
+    0x97, 0x2b, 0xc1, 0xd7, 0x2b, 0xe7, 0xf8, 0x60,
+};
+
+static const uint8_t multi_single_request[] = {
+    0x02, 0x29, 0xa9, 0xa3, 0x17, 0x01, 0x00, 0x00, 0x00, 0x07, 0x65, 0x53,
+    0xf1, 0x00, 0x01, 0x06, 0x01, 0x1f, 0x71, 0xfb, 0x04, 0xcb, 0x00, 0xe5,
+    0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9,
+    0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75,
+    0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0x00, 0x02, 0x05, 0x12, 0x09, 0xe2, 0x56, 0x91, 0x67, 0x22, 0xd7, 0x65,
+    0x84, 0x4c, 0xe0, 0x61, 0xdc, 0x6a, 0xd1, 0x8f, 0x35, 0x91, 0x46, 0x5b,
+    0x0c, 0x60, 0xc7, 0x03, 0xe8, 0xcf, 0x8c, 0x32, 0x5e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20, 0x54,
+    0x4f, 0x4e, 0x21,
+};
+
+static const uint8_t multi_single_hash[] = {
+    0xc5, 0x62, 0x74, 0x6f, 0x3a, 0x54, 0x1a, 0xff, 0x04, 0xb2, 0xc1, 0x91,
+    0xfe, 0x58, 0x60, 0xf7, 0xa7, 0x8b, 0x3e, 0x73, 0xad, 0x6d, 0x0b, 0xd4,
+    0x75, 0x9b, 0xda, 0xff, 0x87, 0x05, 0xda, 0xe7,
+};
+
+static const uint8_t multi_four_request[] = {
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x65, 0x53,
+    0xf1, 0x00, 0x04, 0x01, 0x01, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3,
+    0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e,
+    0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca,
+    0xdb, 0xec, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0xe5, 0xd2,
+    0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca,
+    0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86,
+    0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x03, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4, 0xe6,
+    0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31, 0x42,
+    0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3,
+    0xb1, 0xc0, 0xd4, 0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e,
+    0x1f, 0x20, 0x31, 0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca,
+    0xdb, 0xec, 0x01, 0x03, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t multi_four_hash[] = {
+    0xb7, 0xfc, 0x6e, 0x5e, 0xbb, 0x70, 0xcb, 0x3d, 0xbc, 0x79, 0x82, 0xac,
+    0x62, 0x92, 0x08, 0xd4, 0xf8, 0xe3, 0x8d, 0xeb, 0xfc, 0xc8, 0xe4, 0xb5,
+    0xed, 0xac, 0x5c, 0x58, 0x6b, 0xf6, 0x98, 0xdd,
+};
+
+// Jetton transfers with an inline forward payload: empty, with data and with a
+// reference only. Their order hashes are not checked.
+
+static const uint8_t jetton_boc_inline_empty_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x01, 0x00, 0x02, 0x00, 0x61, 0xb5, 0xee, 0x9c, 0x72, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x56, 0x00, 0x00, 0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0xf4, 0x24, 0x08, 0x00, 0x00,
+    0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18,
+    0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30,
+    0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x80,
+    0xc1, 0x01, 0x41, 0x81, 0xc2, 0x02, 0x42, 0x82, 0xc3, 0x03, 0x43, 0x83,
+    0xc4, 0x04, 0x44, 0x84, 0xc5, 0x05, 0x45, 0x85, 0xc6, 0x06, 0x46, 0x86,
+    0xc7, 0x07, 0x47, 0x87, 0xc2, 0x02, 0x00,
+};
+
+static const uint8_t jetton_boc_inline_payload_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x01, 0x00, 0x02, 0x00, 0x67, 0xb5, 0xee, 0x9c, 0x72, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x5c, 0x00, 0x00, 0xb4, 0x0f, 0x8a, 0x7e, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0xf4, 0x24, 0x08, 0x00, 0x00,
+    0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18,
+    0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30,
+    0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x80,
+    0xc1, 0x01, 0x41, 0x81, 0xc2, 0x02, 0x42, 0x82, 0xc3, 0x03, 0x43, 0x83,
+    0xc4, 0x04, 0x44, 0x84, 0xc5, 0x05, 0x45, 0x85, 0xc6, 0x06, 0x46, 0x86,
+    0xc7, 0x07, 0x47, 0x87, 0xc2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x68, 0x69,
+    0x00,
+};
+
+
+static const uint8_t jetton_boc_inline_ref_request[] = {
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x53, 0xf1, 0x00, 0x04, 0x02, 0xfa,
+    0xf0, 0x80, 0x00, 0xe5, 0xd2, 0xc8, 0xb8, 0xa2, 0xf3, 0xb1, 0xc0, 0xd4,
+    0xe6, 0xf7, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0xfd, 0x0e, 0x1f, 0x20, 0x31,
+    0x42, 0x53, 0x64, 0x75, 0x86, 0x97, 0xa8, 0xb9, 0xca, 0xdb, 0xec, 0x01,
+    0x01, 0x00, 0x02, 0x00, 0x68, 0xb5, 0xee, 0x9c, 0x72, 0x01, 0x01, 0x02,
+    0x01, 0x00, 0x5d, 0x00, 0x01, 0xa8, 0x0f, 0x8a, 0x7e, 0xa5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x30, 0xf4, 0x24, 0x08, 0x00, 0x00,
+    0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18,
+    0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30,
+    0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x80,
+    0xc1, 0x01, 0x41, 0x81, 0xc2, 0x02, 0x42, 0x82, 0xc3, 0x03, 0x43, 0x83,
+    0xc4, 0x04, 0x44, 0x84, 0xc5, 0x05, 0x45, 0x85, 0xc6, 0x06, 0x46, 0x86,
+    0xc7, 0x07, 0x47, 0x87, 0xc2, 0x02, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+
+typedef struct {
+    const char *name;
+    const uint8_t *request;
+    size_t request_len;
+    const uint8_t *hash;
+    bool is_blind;
+    uint8_t hints_count;
+    const char *title;
+} tx_vector_t;
+
+#define VECTOR(name, blind, count, title) \
+    { #name, name##_request, sizeof(name##_request), name##_hash, blind, count, title }
+
+static const tx_vector_t vectors[] = {
+    VECTOR(transfer, false, 0, "Transfer"),
+    VECTOR(comment, false, 1, "Transfer"),
+    VECTOR(jetton, false, 2, "Transfer jetton"),
+    VECTOR(blind_state_init, true, 0, "Transaction"),
+    VECTOR(subwallet, false, 1, "Transfer"),
+    VECTOR(burn_inline, false, 2, "Burn jetton"),
+    VECTOR(dns_wallet, false, 2, "Change DNS"),
+    VECTOR(dao_vote, false, 3, "Vote proposal"),
+    VECTOR(jetton_boc, false, 2, "Transfer jetton"),
+    VECTOR(comment_boc, false, 1, "Transfer"),
+    VECTOR(nft_boc, true, 0, "Transaction"),  // inline forward payload
+    VECTOR(unknown_boc, true, 0, "Transaction"),
+    VECTOR(jetton_boc_hints, false, 2, "Transfer jetton"),
+    VECTOR(burn_boc, false, 2, "Burn jetton"),
+    VECTOR(dao_vote_boc, false, 3, "Vote proposal"),
+    VECTOR(withdraw_boc, false, 1, "Withdraw stake"),
+    VECTOR(multi_blind, true, 11, "Send 3 messages"),
+    VECTOR(multi_jetton, false, 9, "Send 2 messages"),
+    VECTOR(multi_single, false, 1, "Transfer"),
+    VECTOR(multi_four, false, 13, "Send 4 messages"),
+};
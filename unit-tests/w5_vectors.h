@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Requests and expected hashes were generated with an independent implementation of
+// the wallet v5 signed request serialization.
+
+static const uint8_t w5_transfer_request[] = {
+    0x04, 0x7f, 0xff, 0xff, 0x11, 0x65, 0x53, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x02, 0x04, 0x02, 0xfa, 0xf0, 0x80, 0x00, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x05,
+    0xf5, 0xe1, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x01, 0x03, 0x00, 0x00, 0x00,
+};
+static const uint8_t w5_transfer_hash[] = {
+    0x2a, 0x6b, 0xe6, 0x36, 0xad, 0x1d, 0x54, 0xfc, 0xd2, 0x30, 0x5c, 0x14,
+    0x1f, 0x3c, 0x09, 0x98, 0x27, 0xbb, 0xcc, 0xf4, 0x7d, 0x0d, 0xbf, 0x16,
+    0x87, 0xb2, 0xaa, 0xf7, 0x31, 0x6a, 0xf5, 0x7c,
+};
+static const uint8_t w5_single_request[] = {
+    0x04, 0x7f, 0xff, 0xff, 0x11, 0x65, 0x53, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x04, 0x02, 0xfa, 0xf0, 0x80, 0x00, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x03, 0x00, 0x00, 0x00,
+};
+static const uint8_t w5_single_hash[] = {
+    0x12, 0xe6, 0xe8, 0x2e, 0x97, 0xd3, 0xee, 0x64, 0x9d, 0xd7, 0xe3, 0x67,
+    0xb0, 0xf9, 0x38, 0x4f, 0x9d, 0xde, 0x56, 0xae, 0x44, 0x5e, 0xad, 0xf1,
+    0x37, 0x28, 0xec, 0x9e, 0x53, 0x7e, 0xa2, 0xd2,
+};
+static const uint8_t w5_extensions_request[] = {
+    0x04, 0x12, 0x34, 0x56, 0x78, 0x65, 0x53, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x03, 0x02, 0x00, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+    0x03, 0xff, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x04, 0x00,
+    0x00,
+};
+static const uint8_t w5_extensions_hash[] = {
+    0xaf, 0x88, 0xb4, 0x22, 0xe4, 0xc6, 0xa2, 0x9e, 0x0c, 0xef, 0x6d, 0xe4,
+    0x3a, 0xf0, 0xae, 0x8b, 0x18, 0x8f, 0x01, 0xee, 0x03, 0x9c, 0x35, 0xf1,
+    0x19, 0x81, 0x86, 0x4b, 0x2a, 0x38, 0xec, 0xcc,
+};
+static const uint8_t w5_mixed_request[] = {
+    0x04, 0x7f, 0xff, 0xff, 0x11, 0x65, 0x53, 0xf1, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x02, 0x02, 0x00, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+    0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+    0x03, 0xff, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+    0x00, 0x01, 0x00, 0x01, 0xe4, 0x73, 0xae, 0xf4, 0xdd, 0x06, 0x28, 0x7f,
+    0xdd, 0xb8, 0x48, 0x73, 0xfa, 0x21, 0xe6, 0x6c, 0xfb, 0x40, 0x3b, 0x85,
+    0x7b, 0x4e, 0x6a, 0x0e, 0xf9, 0x6f, 0x0d, 0xad, 0x2f, 0xa5, 0x92, 0xbf,
+    0x00,
+};
+static const uint8_t w5_mixed_hash[] = {
+    0xd5, 0xe7, 0x15, 0xa6, 0xc4, 0x3f, 0xa3, 0x55, 0x39, 0x6b, 0x02, 0xc4,
+    0xaa, 0x90, 0x4e, 0x4a, 0x4f, 0x69, 0x0d, 0x3c, 0x3e, 0xe3, 0x32, 0x21,
+    0x91, 0x27, 0xcb, 0x0a, 0xc7, 0xf7, 0xb8, 0xa1,
+};
+typedef struct {
+    const char *name;
+    const uint8_t *request;
+    size_t request_len;
+    const uint8_t *hash;
+    bool is_blind;
+    const char *title;
+} w5_vector_t;
+
+#define W5_VECTOR(name, blind, title) \
+    { #name, name##_request, sizeof(name##_request), name##_hash, blind, title }
+
+static const w5_vector_t w5_vectors[] = {
+    W5_VECTOR(w5_transfer, false, "Send 2 messages"),
+    W5_VECTOR(w5_single, false, "Send message"),
+    W5_VECTOR(w5_extensions, false, "Update wallet"),
+    W5_VECTOR(w5_mixed, true, "Send message"),
+};